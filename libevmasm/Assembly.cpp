@@ -34,6 +34,9 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <libsolutil/Parallel.h>
+#include <libsolutil/Profiler.h>
+
 #include <json/json.h>
 
 #include <range/v3/algorithm/any_of.hpp>
@@ -417,32 +420,68 @@ Assembly& Assembly::optimise(bool _enable, EVMVersion _evmVersion, bool _isCreat
 }
 
 
-Assembly& Assembly::optimise(OptimiserSettings const& _settings)
+Assembly& Assembly::optimise(OptimiserSettings const& _settings, size_t _parallelism)
 {
-	optimiseInternal(_settings, {});
+	util::ProfilerScope profilerScope("evmasm", "Assembly::optimise");
+	vector<vector<OptimisationJob>> jobsByLevel;
+	map<Assembly const*, optional<size_t>> levels;
+	collectOptimisationJobs(_settings, {}, jobsByLevel, levels);
+	// Assemblies of the same level neither contain each other nor share tag replacements
+	// that are not yet known, since all their sub-assemblies are on lower levels.
+	for (vector<OptimisationJob> const& jobs: jobsByLevel)
+		util::parallelFor(jobs.size(), _parallelism, [&](size_t _index) {
+			OptimisationJob const& job = jobs[_index];
+			job.assembly->optimiseInternal(job.settings, job.tagsReferencedFromOutside);
+		});
 	return *this;
 }
 
-map<u256, u256> const& Assembly::optimiseInternal(
+optional<size_t> Assembly::collectOptimisationJobs(
 	OptimiserSettings const& _settings,
-	std::set<size_t> _tagsReferencedFromOutside
+	set<size_t> _tagsReferencedFromOutside,
+	vector<vector<OptimisationJob>>& _jobsByLevel,
+	map<Assembly const*, optional<size_t>>& _levels
 )
 {
+	if (auto visited = _levels.find(this); visited != _levels.end())
+		return visited->second;
 	if (m_tagReplacements)
-		return *m_tagReplacements;
+		return _levels[this] = nullopt;
 
-	// Run optimisation for sub-assemblies.
+	size_t level = 0;
 	for (size_t subId = 0; subId < m_subs.size(); ++subId)
 	{
 		OptimiserSettings settings = _settings;
 		// Disable creation mode for sub-assemblies.
 		settings.isCreation = false;
-		map<u256, u256> const& subTagReplacements = m_subs[subId]->optimiseInternal(
+		// Tag replacements of other sub-assemblies do not change the references to this one.
+		if (optional<size_t> subLevel = m_subs[subId]->collectOptimisationJobs(
 			settings,
-			JumpdestRemover::referencedTags(m_items, subId)
-		);
+			JumpdestRemover::referencedTags(m_items, subId),
+			_jobsByLevel,
+			_levels
+		))
+			level = max(level, *subLevel + 1);
+	}
+
+	if (_jobsByLevel.size() <= level)
+		_jobsByLevel.resize(level + 1);
+	_jobsByLevel[level].push_back({this, _settings, move(_tagsReferencedFromOutside)});
+	return _levels[this] = level;
+}
+
+void Assembly::optimiseInternal(
+	OptimiserSettings const& _settings,
+	set<size_t> _tagsReferencedFromOutside
+)
+{
+	assertThrow(!m_tagReplacements, OptimizerException, "Assembly optimised twice.");
+
+	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+	{
+		assertThrow(m_subs[subId]->m_tagReplacements, OptimizerException, "Sub-assembly not optimised.");
 		// Apply the replacements (can be empty).
-		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements, subId);
+		BlockDeduplicator::applyTagReplacement(m_items, *m_subs[subId]->m_tagReplacements, subId);
 	}
 
 	map<u256, u256> tagReplacements;
@@ -514,10 +553,14 @@ map<u256, u256> const& Assembly::optimiseInternal(
 				return _i == AssemblyItem{Instruction::MSIZE} || _i.type() == VerbatimBytecode;
 			});
 
+			// The classes are reset for every block, only their storage is reused.
+			// Sharing the classes themselves would renumber them and thus change the output.
+			auto expressionClasses = make_shared<ExpressionClasses>();
 			auto iter = m_items.begin();
 			while (iter != m_items.end())
 			{
-				KnownState emptyState;
+				expressionClasses->clear();
+				KnownState emptyState{expressionClasses};
 				CommonSubexpressionEliminator eliminator{emptyState};
 				auto orig = iter;
 				iter = eliminator.feedItems(iter, m_items.end(), usesMSize);
@@ -564,7 +607,6 @@ map<u256, u256> const& Assembly::optimiseInternal(
 		);
 
 	m_tagReplacements = move(tagReplacements);
-	return *m_tagReplacements;
 }
 
 LinkerObject const& Assembly::assemble() const
@@ -39,6 +39,9 @@
 #include <sstream>
 #include <memory>
 #include <map>
+#include <optional>
+#include <set>
+#include <vector>
 
 namespace solidity::evmasm
 {
@@ -132,7 +135,9 @@ public:
 
 	/// Modify and return the current assembly such that creation and execution gas usage
 	/// is optimised according to the settings in @a _settings.
-	Assembly& optimise(OptimiserSettings const& _settings);
+	/// Sub-assemblies that do not contain each other are optimised on up to @a _parallelism
+	/// threads. The result does not depend on the number of threads.
+	Assembly& optimise(OptimiserSettings const& _settings, size_t _parallelism = 1);
 
 	/// Modify (if @a _enable is set) and return the current assembly such that creation and
 	/// execution gas usage is optimised. @a _isCreation should be true for the top-level assembly.
@@ -165,10 +170,34 @@ public:
 	size_t encodeSubPath(std::vector<size_t> const& _subPath);
 
 protected:
-	/// Does the same operations as @a optimise, but should only be applied to a sub and
-	/// returns the replaced tags. Also takes an argument containing the tags of this assembly
-	/// that are referenced in a super-assembly.
-	std::map<u256, u256> const& optimiseInternal(OptimiserSettings const& _settings, std::set<size_t> _tagsReferencedFromOutside);
+	/// An assembly that still has to be optimised, together with its settings and the tags
+	/// of it that are referenced in its super-assembly.
+	struct OptimisationJob
+	{
+		Assembly* assembly = nullptr;
+		OptimiserSettings settings;
+		std::set<size_t> tagsReferencedFromOutside;
+	};
+
+	/// Adds jobs for this assembly and all its sub-assemblies that have not been optimised yet.
+	/// An assembly used in several places is optimised in the context of its first occurrence in
+	/// depth-first order, as if the sub-assemblies were optimised recursively one after the other.
+	/// The jobs are grouped by their distance to the leaves, so jobs of the same level do not
+	/// depend on each other.
+	/// @a _levels contains the levels of all assemblies visited so far.
+	/// @returns the level of this assembly or nullopt if it does not need to be optimised.
+	std::optional<size_t> collectOptimisationJobs(
+		OptimiserSettings const& _settings,
+		std::set<size_t> _tagsReferencedFromOutside,
+		std::vector<std::vector<OptimisationJob>>& _jobsByLevel,
+		std::map<Assembly const*, std::optional<size_t>>& _levels
+	);
+
+	/// Applies the tag replacements of the (already optimised) sub-assemblies and optimises the
+	/// items of this assembly only. Stores the replaced tags in @a m_tagReplacements.
+	/// Also takes an argument containing the tags of this assembly that are referenced in a
+	/// super-assembly.
+	void optimiseInternal(OptimiserSettings const& _settings, std::set<size_t> _tagsReferencedFromOutside);
 
 	unsigned codeSize(unsigned subTagSize) const;
 
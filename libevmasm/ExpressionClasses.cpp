@@ -27,6 +27,8 @@
 #include <libevmasm/CommonSubexpressionEliminator.h>
 #include <libevmasm/SimplificationRules.h>
 
+#include <boost/functional/hash.hpp>
+
 #include <functional>
 #include <tuple>
 #include <limits>
@@ -55,6 +57,33 @@ bool ExpressionClasses::Expression::operator<(ExpressionClasses::Expression cons
 			std::tie(_other.item->data(), _other.arguments, _other.sequenceNumber);
 }
 
+bool ExpressionClasses::Expression::operator==(ExpressionClasses::Expression const& _other) const
+{
+	assertThrow(!!item && !!_other.item, OptimizerException, "");
+	auto type = item->type();
+	if (type != _other.item->type() || arguments != _other.arguments || sequenceNumber != _other.sequenceNumber)
+		return false;
+	else if (type == Operation)
+		return item->instruction() == _other.item->instruction();
+	else
+		return item->data() == _other.item->data();
+}
+
+size_t ExpressionClasses::ExpressionHash::operator()(ExpressionClasses::Expression const& _expression) const
+{
+	assertThrow(!!_expression.item, OptimizerException, "");
+	AssemblyItem const& item = *_expression.item;
+	size_t seed = static_cast<size_t>(item.type());
+	if (item.type() == Operation)
+		boost::hash_combine(seed, static_cast<uint8_t>(item.instruction()));
+	else
+		// The low bits suffice, collisions only cost a comparison.
+		boost::hash_combine(seed, static_cast<size_t>(item.data() & numeric_limits<size_t>::max()));
+	boost::hash_range(seed, _expression.arguments.begin(), _expression.arguments.end());
+	boost::hash_combine(seed, _expression.sequenceNumber);
+	return seed;
+}
+
 ExpressionClasses::Id ExpressionClasses::find(
 	AssemblyItem const& _item,
 	Ids const& _arguments,
@@ -181,9 +210,17 @@ string ExpressionClasses::fullDAGToString(ExpressionClasses::Id _id) const
 	return str.str();
 }
 
+void ExpressionClasses::clear()
+{
+	m_representatives.clear();
+	m_expressions.clear();
+	m_spareAssemblyItems.clear();
+}
+
 ExpressionClasses::Id ExpressionClasses::tryToSimplify(Expression const& _expr)
 {
-	static Rules rules;
+	// The rules store the match groups of the current match, so they cannot be shared between threads.
+	static thread_local Rules rules;
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
 	if (
@@ -30,7 +30,7 @@
 #include <vector>
 #include <map>
 #include <memory>
-#include <set>
+#include <unordered_set>
 
 namespace solidity::langutil
 {
@@ -62,6 +62,14 @@ public:
 		unsigned sequenceNumber = 0;
 		/// Behaves as if this was a tuple of (item->type(), item->data(), arguments, sequenceNumber).
 		bool operator<(Expression const& _other) const;
+		/// Equality consistent with operator<, i.e. true iff neither is less than the other.
+		bool operator==(Expression const& _other) const;
+	};
+
+	/// Hash consistent with Expression::operator==.
+	struct ExpressionHash
+	{
+		size_t operator()(Expression const& _expression) const;
 	};
 
 	/// Retrieves the id of the expression equivalence class resulting from the given item applied to the
@@ -109,6 +117,10 @@ public:
 
 	std::string fullDAGToString(Id _id) const;
 
+	/// Removes all classes and stored items, but keeps the allocated storage so that the object
+	/// can be reused for the next basic block.
+	void clear();
+
 private:
 	/// Tries to simplify the given expression.
 	/// @returns its class if it possible or Id(-1) otherwise.
@@ -121,8 +133,9 @@ private:
 
 	/// Expression equivalence class representatives - we only store one item of an equivalence.
 	std::vector<Expression> m_representatives;
-	/// All expression ever encountered.
-	std::set<Expression> m_expressions;
+	/// All expression ever encountered, hash-consed so that looking up an expression
+	/// (and thus the result of its simplification) takes constant time.
+	std::unordered_set<Expression, ExpressionHash> m_expressions;
 	std::vector<std::shared_ptr<AssemblyItem>> m_spareAssemblyItems;
 };
 
@@ -91,10 +91,10 @@ string CharStream::lineAtPosition(int _position) const
 		lineStart = 0;
 	else
 		lineStart++;
-	string line = m_source.substr(
+	string line{m_source.substr(
 		lineStart,
 		min(m_source.find('\n', lineStart), m_source.size()) - lineStart
-	);
+	)};
 	if (!line.empty() && line.back() == '\r')
 		line.pop_back();
 	return line;
@@ -123,13 +123,13 @@ string_view CharStream::text(SourceLocation const& _location) const
 		return {};
 	solAssert(_location.sourceName && *_location.sourceName == m_name, "");
 	solAssert(static_cast<size_t>(_location.end) <= m_source.size(), "");
-	return string_view{m_source}.substr(
+	return m_source.substr(
 		static_cast<size_t>(_location.start),
 		static_cast<size_t>(_location.end - _location.start)
 	);
 }
 
-string CharStream::singleLineSnippet(string const& _sourceCode, SourceLocation const& _location)
+string CharStream::singleLineSnippet(string_view _sourceCode, SourceLocation const& _location)
 {
 	if (!_location.hasText())
 		return {};
@@ -137,10 +137,10 @@ string CharStream::singleLineSnippet(string const& _sourceCode, SourceLocation c
 	if (static_cast<size_t>(_location.start) >= _sourceCode.size())
 		return {};
 
-	string cut = _sourceCode.substr(static_cast<size_t>(_location.start), static_cast<size_t>(_location.end - _location.start));
+	string_view cut = _sourceCode.substr(static_cast<size_t>(_location.start), static_cast<size_t>(_location.end - _location.start));
 	auto newLinePos = cut.find_first_of("\n\r");
-	if (newLinePos != string::npos)
-		cut = cut.substr(0, newLinePos) + "...";
+	if (newLinePos != string_view::npos)
+		return string{cut.substr(0, newLinePos)} + "...";
 
-	return cut;
+	return string{cut};
 }
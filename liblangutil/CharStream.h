@@ -50,8 +50,11 @@
 
 #pragma once
 
+#include <libsolutil/SharedText.h>
+
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <utility>
 
@@ -70,12 +73,21 @@ class CharStream
 public:
 	CharStream() = default;
 	CharStream(std::string _source, std::string _name):
-		m_source(std::move(_source)), m_name(std::move(_name)) {}
+		CharStream(util::SharedText::fromString(std::move(_source)), std::move(_name)) {}
+	/// Creates a stream over shared text without copying it, e.g. over a memory-mapped file.
+	CharStream(util::SharedTextPointer _text, std::string _name):
+		m_text(std::move(_text)), m_source(m_text->view()), m_name(std::move(_name)) {}
 
 	size_t position() const { return m_position; }
 	bool isPastEndOfInput(size_t _charsForward = 0) const { return (m_position + _charsForward) >= m_source.size(); }
 
-	char get(size_t _charsForward = 0) const { return m_source[m_position + _charsForward]; }
+	/// @returns the character at the given offset from the current position or 0 past the end of input.
+	/// The source is not necessarily null-terminated, e.g. if it is a memory-mapped file.
+	char get(size_t _charsForward = 0) const
+	{
+		size_t const position = m_position + _charsForward;
+		return position < m_source.size() ? m_source[position] : 0;
+	}
 	char advanceAndGet(size_t _chars = 1);
 	/// Sets scanner position to @ _amount characters backwards in source text.
 	/// @returns The character of the current location after update is returned.
@@ -87,7 +99,9 @@ public:
 
 	void reset() { m_position = 0; }
 
-	std::string const& source() const noexcept { return m_source; }
+	std::string_view source() const noexcept { return m_source; }
+	/// @returns the text the stream reads from. It is shared with all copies of this stream.
+	util::SharedTextPointer const& sharedSource() const noexcept { return m_text; }
 	std::string const& name() const noexcept { return m_name; }
 
 	size_t size() const { return m_source.size(); }
@@ -125,10 +139,11 @@ public:
 		return singleLineSnippet(m_source, _location);
 	}
 
-	static std::string singleLineSnippet(std::string const& _sourceCode, SourceLocation const& _location);
+	static std::string singleLineSnippet(std::string_view _sourceCode, SourceLocation const& _location);
 
 private:
-	std::string m_source;
+	util::SharedTextPointer m_text;
+	std::string_view m_source;
 	std::string m_name;
 	size_t m_position{0};
 };
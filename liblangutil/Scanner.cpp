@@ -61,6 +61,10 @@
 #include <tuple>
 #include <array>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 using namespace std;
 
 namespace solidity::langutil
@@ -96,6 +100,153 @@ ostream& operator<<(ostream& os, ScannerError _errorCode)
 	return os << to_string(_errorCode);
 }
 
+namespace
+{
+
+/// Classes of characters that the scanner skips over in bulk. Each class tests single characters
+/// and, if SSE2 is available, blocks of 16 characters at once, where the result has all bits of
+/// the bytes set that belong to the class.
+
+#if defined(__SSE2__)
+__m128i equals(__m128i _block, char _c)
+{
+	return _mm_cmpeq_epi8(_block, _mm_set1_epi8(_c));
+}
+
+/// Tests for the range [@a _first, @a _last], which must only contain ASCII characters.
+__m128i inRange(__m128i _block, char _first, char _last)
+{
+	return _mm_and_si128(
+		_mm_cmpgt_epi8(_block, _mm_set1_epi8(static_cast<char>(_first - 1))),
+		_mm_cmplt_epi8(_block, _mm_set1_epi8(static_cast<char>(_last + 1)))
+	);
+}
+
+/// Tests for the characters that isUnicodeLinebreak() can start with.
+__m128i isLinebreakStart(__m128i _block)
+{
+	return _mm_or_si128(
+		inRange(_block, 0x0a, 0x0d),
+		_mm_or_si128(equals(_block, static_cast<char>(0xc2)), equals(_block, static_cast<char>(0xe2)))
+	);
+}
+#endif
+
+bool isLinebreakStart(char _c)
+{
+	auto const c = static_cast<unsigned char>(_c);
+	return (0x0a <= c && c <= 0x0d) || c == 0xc2 || c == 0xe2;
+}
+
+struct WhiteSpaceClass
+{
+	bool contains(char _c) const { return isWhiteSpace(_c); }
+#if defined(__SSE2__)
+	__m128i contains(__m128i _block) const
+	{
+		return _mm_or_si128(
+			_mm_or_si128(equals(_block, ' '), equals(_block, '\t')),
+			_mm_or_si128(equals(_block, '\n'), equals(_block, '\r'))
+		);
+	}
+#endif
+};
+
+struct IdentifierPartClass
+{
+	/// Whether '.' is part of identifiers, as it is in Yul.
+	bool withDot;
+
+	bool contains(char _c) const { return isIdentifierPart(_c) || (withDot && _c == '.'); }
+#if defined(__SSE2__)
+	__m128i contains(__m128i _block) const
+	{
+		// Setting the 0x20 bit maps upper case letters to lower case letters
+		// and no other characters to lower case letters.
+		__m128i const letters = inRange(_mm_or_si128(_block, _mm_set1_epi8(0x20)), 'a', 'z');
+		__m128i const dot = withDot ? equals(_block, '.') : _mm_setzero_si128();
+		return _mm_or_si128(
+			_mm_or_si128(letters, inRange(_block, '0', '9')),
+			_mm_or_si128(_mm_or_si128(equals(_block, '_'), equals(_block, '$')), dot)
+		);
+	}
+#endif
+};
+
+/// Characters in a line that cannot end the line.
+struct LineContentClass
+{
+	bool contains(char _c) const { return !isLinebreakStart(_c); }
+#if defined(__SSE2__)
+	__m128i contains(__m128i _block) const
+	{
+		return _mm_andnot_si128(isLinebreakStart(_block), _mm_set1_epi8(-1));
+	}
+#endif
+};
+
+/// Characters in a multi-line comment that cannot end the line or the comment.
+struct MultiLineCommentContentClass
+{
+	bool contains(char _c) const { return _c != '\n' && _c != '\r' && _c != '*'; }
+#if defined(__SSE2__)
+	__m128i contains(__m128i _block) const
+	{
+		return _mm_andnot_si128(
+			_mm_or_si128(_mm_or_si128(equals(_block, '\n'), equals(_block, '\r')), equals(_block, '*')),
+			_mm_set1_epi8(-1)
+		);
+	}
+#endif
+};
+
+/// Characters of a string literal that are taken over into the literal as they are.
+struct PlainStringContentClass
+{
+	char quote;
+	/// Whether this is a unicode string literal, which may contain non-printable characters.
+	bool isUnicode;
+
+	bool contains(char _c) const
+	{
+		if (_c == quote || _c == '\\')
+			return false;
+		if (isUnicode)
+			return !isLinebreakStart(_c);
+		return 0x20 <= _c && _c <= 0x7e;
+	}
+#if defined(__SSE2__)
+	__m128i contains(__m128i _block) const
+	{
+		__m128i const special = _mm_or_si128(equals(_block, quote), equals(_block, '\\'));
+		if (isUnicode)
+			return _mm_andnot_si128(_mm_or_si128(special, isLinebreakStart(_block)), _mm_set1_epi8(-1));
+		return _mm_andnot_si128(special, inRange(_block, 0x20, 0x7e));
+	}
+#endif
+};
+
+/// @returns the number of characters at the start of @a _text that belong to @a _class.
+template <typename CharacterClass>
+size_t span(string_view _text, CharacterClass const& _class)
+{
+	size_t position = 0;
+#if defined(__SSE2__)
+	for (; position + 16 <= _text.size(); position += 16)
+	{
+		__m128i const block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(_text.data() + position));
+		auto const outside = ~static_cast<unsigned>(_mm_movemask_epi8(_class.contains(block))) & 0xffffu;
+		if (outside != 0)
+			return position + static_cast<size_t>(__builtin_ctz(outside));
+	}
+#endif
+	while (position < _text.size() && _class.contains(_text[position]))
+		++position;
+	return position;
+}
+
+}
+
 /// Scoped helper for literal recording. Automatically drops the literal
 /// if aborting the scanning before it's complete.
 enum LiteralType
@@ -245,11 +396,29 @@ Token Scanner::selectToken(char _next, Token _then, Token _else)
 		return _else;
 }
 
+void Scanner::addLiteralAndAdvance(size_t _count)
+{
+	m_tokens[NextNext].literal += remainingSource().substr(0, _count);
+	m_char = m_source.advanceAndGet(_count);
+}
+
+void Scanner::addCommentLiteralAndAdvance(size_t _count)
+{
+	m_skippedComments[NextNext].literal += remainingSource().substr(0, _count);
+	m_char = m_source.advanceAndGet(_count);
+}
+
 bool Scanner::skipWhitespace()
 {
 	size_t const startPosition = sourcePos();
-	while (isWhiteSpace(m_char))
+	// The current character is not necessarily the one at the current position,
+	// e.g. after a multi-line comment, so it is skipped on its own.
+	if (isWhiteSpace(m_char))
+	{
 		advance();
+		if (size_t const count = span(remainingSource(), WhiteSpaceClass{}))
+			m_char = m_source.advanceAndGet(count);
+	}
 	// Return whether or not we skipped any characters.
 	return sourcePos() != startPosition;
 }
@@ -283,6 +452,11 @@ static ScannerError validateBiDiMarkup(CharStream& _stream, size_t _startPositio
 	};
 
 	size_t endPosition = _stream.position();
+
+	// All the sequences start with the same byte.
+	if (_stream.source().substr(_startPosition, endPosition - _startPosition).find('\xE2') == string_view::npos)
+		return ScannerError::NoError;
+
 	_stream.setPosition(_startPosition);
 
 	int directionOverrideDepth = 0;
@@ -312,8 +486,12 @@ Token Scanner::skipSingleLineComment()
 	// non-ascii line terminator, it will result in a parser error.
 	size_t startPosition = m_source.position();
 	while (!isUnicodeLinebreak())
+	{
 		if (!advance())
 			break;
+		if (size_t const count = span(remainingSource(), LineContentClass{}))
+			m_char = m_source.advanceAndGet(count);
+	}
 
 	ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
 	if (unicodeDirectionError != ScannerError::NoError)
@@ -383,6 +561,10 @@ size_t Scanner::scanSingleLineDocComment()
 			break;
 		addCommentLiteralChar(m_char);
 		advance();
+		// The rest of the line except for its last character is added at once.
+		// The last character is left to the loop, which keeps track of the end position.
+		if (size_t const count = span(remainingSource(), LineContentClass{}); count > 1)
+			addCommentLiteralAndAdvance(count - 1);
 	}
 	literal.complete();
 	return endPosition;
@@ -391,26 +573,24 @@ size_t Scanner::scanSingleLineDocComment()
 Token Scanner::skipMultiLineComment()
 {
 	size_t startPosition = m_source.position();
-	while (!isSourcePastEndOfInput())
+	size_t terminatorPosition = m_source.source().find("*/", startPosition);
+	if (terminatorPosition == string_view::npos)
 	{
-		char prevChar = m_char;
-		advance();
+		// Unterminated multi-line comment.
+		m_char = m_source.setPosition(m_source.size());
+		return setError(ScannerError::IllegalCommentTerminator);
+	}
 
-		// If we have reached the end of the multi-line comment, we
-		// consume the '/' and insert a whitespace. This way all
-		// multi-line comments are treated as whitespace.
-		if (prevChar == '*' && m_char == '/')
-		{
-			ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
-			if (unicodeDirectionError != ScannerError::NoError)
-				return setError(unicodeDirectionError);
+	// We have reached the end of the multi-line comment, we
+	// consume the '/' and insert a whitespace. This way all
+	// multi-line comments are treated as whitespace.
+	m_char = m_source.setPosition(terminatorPosition + 1);
+	ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
+	if (unicodeDirectionError != ScannerError::NoError)
+		return setError(unicodeDirectionError);
 
-			m_char = ' ';
-			return Token::Whitespace;
-		}
-	}
-	// Unterminated multi-line comment.
-	return setError(ScannerError::IllegalCommentTerminator);
+	m_char = ' ';
+	return Token::Whitespace;
 }
 
 Token Scanner::scanMultiLineDocComment()
@@ -460,6 +640,8 @@ Token Scanner::scanMultiLineDocComment()
 		addCommentLiteralChar(m_char);
 		charsAdded = true;
 		advance();
+		if (size_t const count = span(remainingSource(), MultiLineCommentContentClass{}))
+			addCommentLiteralAndAdvance(count);
 	}
 	literal.complete();
 	if (!endFound)
@@ -539,8 +721,8 @@ void Scanner::scanToken()
 
 	Token token;
 	// M and N are for the purposes of grabbing different type sizes
-	unsigned m;
-	unsigned n;
+	unsigned m = 0;
+	unsigned n = 0;
 	do
 	{
 		// Remember the position of the next token
@@ -846,6 +1028,8 @@ Token Scanner::scanString(bool const _isUnicode)
 			if (!_isUnicode && (static_cast<unsigned>(c) <= 0x1f || static_cast<unsigned>(c) >= 0x7f))
 				return setError(ScannerError::IllegalCharacterInString);
 			addLiteralChar(c);
+			if (size_t const count = span(remainingSource(), PlainStringContentClass{quote, _isUnicode}))
+				addLiteralAndAdvance(count);
 		}
 	}
 	if (m_char != quote)
@@ -1012,8 +1196,7 @@ tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
 	addLiteralCharAndAdvance();
 	// Scan the rest of the identifier characters.
-	while (isIdentifierPart(m_char) || (m_char == '.' && m_kind == ScannerKind::Yul))
-		addLiteralCharAndAdvance();
+	addLiteralAndAdvance(span(remainingSource(), IdentifierPartClass{m_kind == ScannerKind::Yul}));
 	literal.complete();
 	auto const token = TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
 	if (m_kind == ScannerKind::Yul)
@@ -58,6 +58,7 @@
 
 #include <optional>
 #include <iosfwd>
+#include <string_view>
 
 namespace solidity::langutil
 {
@@ -196,6 +197,10 @@ private:
 	inline void addLiteralChar(char c) { m_tokens[NextNext].literal.push_back(c); }
 	inline void addCommentLiteralChar(char c) { m_skippedComments[NextNext].literal.push_back(c); }
 	inline void addLiteralCharAndAdvance() { addLiteralChar(m_char); advance(); }
+	/// Appends the first @a _count characters at the current position to the literal and skips them.
+	void addLiteralAndAdvance(size_t _count);
+	/// Appends the first @a _count characters at the current position to the comment literal and skips them.
+	void addCommentLiteralAndAdvance(size_t _count);
 	void addUnicodeAsUTF8(unsigned codepoint);
 	///@}
 
@@ -250,6 +255,8 @@ private:
 
 	/// Return the current source position.
 	size_t sourcePos() const { return m_source.position(); }
+	/// @returns the part of the source starting at the current position.
+	std::string_view remainingSource() const { return m_source.source().substr(m_source.position()); }
 	bool isSourcePastEndOfInput() const { return m_source.isPastEndOfInput(); }
 
 	enum TokenIndex { Current, Next, NextNext };
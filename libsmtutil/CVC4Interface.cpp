@@ -20,6 +20,7 @@
 
 #include <libsolutil/CommonIO.h>
 
+#include <cvc4/base/configuration.h>
 #include <cvc4/util/bitvector.h>
 
 using namespace std;
@@ -34,6 +35,11 @@ CVC4Interface::CVC4Interface(optional<unsigned> _queryTimeout):
 	reset();
 }
 
+string CVC4Interface::version()
+{
+	return CVC4::Configuration::getVersionString();
+}
+
 void CVC4Interface::reset()
 {
 	m_variables.clear();
@@ -45,6 +45,9 @@ public:
 
 	CVC4Interface(std::optional<unsigned> _queryTimeout = {});
 
+	/// @returns the version string of the CVC4 library in use.
+	static std::string version();
+
 	void reset() override;
 
 	void push() override;
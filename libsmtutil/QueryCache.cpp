@@ -0,0 +1,112 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsmtutil/QueryCache.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Keccak256.h>
+
+#include <boost/algorithm/string/split.hpp>
+
+#include <fstream>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::smtutil;
+
+namespace fs = boost::filesystem;
+
+optional<QueryCache::Result> QueryCache::lookup(string const& _query) const
+{
+	string entry;
+	try
+	{
+		fs::path path = entryPath(_query);
+		if (!fs::exists(path))
+			return nullopt;
+		entry = readFileAsString(path);
+	}
+	catch (...)
+	{
+		return nullopt;
+	}
+
+	// The first line is the result, every following line the value of one of the
+	// evaluated expressions. Values are integers or booleans and never contain newlines.
+	vector<string> lines;
+	boost::split(lines, entry, [](char _c) { return _c == '\n'; });
+	if (lines.empty() || !lines.back().empty())
+		return nullopt;
+	lines.pop_back();
+
+	Result result;
+	if (lines.front() == "sat")
+		result.first = CheckResult::SATISFIABLE;
+	else if (lines.front() == "unsat")
+		result.first = CheckResult::UNSATISFIABLE;
+	else
+		return nullopt;
+	result.second.assign(next(lines.begin()), lines.end());
+	return result;
+}
+
+void QueryCache::store(string const& _query, Result const& _result) const
+{
+	string entry;
+	if (_result.first == CheckResult::SATISFIABLE)
+		entry = "sat\n";
+	else if (_result.first == CheckResult::UNSATISFIABLE)
+		entry = "unsat\n";
+	else
+		return;
+	for (string const& value: _result.second)
+	{
+		if (value.find('\n') != string::npos)
+			return;
+		entry += value + "\n";
+	}
+
+	try
+	{
+		fs::create_directories(m_directory);
+		fs::path path = entryPath(_query);
+		// Write to a temporary file first and rename it, so that concurrent users
+		// of the same directory never observe a partially written entry.
+		fs::path temporaryPath = m_directory / fs::unique_path(path.filename().string() + ".%%%%-%%%%-%%%%.tmp");
+		{
+			ofstream file(temporaryPath.string(), ios::binary | ios::trunc);
+			file << entry;
+			if (!file)
+			{
+				file.close();
+				fs::remove(temporaryPath);
+				return;
+			}
+		}
+		fs::rename(temporaryPath, path);
+	}
+	catch (...)
+	{
+	}
+}
+
+fs::path QueryCache::entryPath(string const& _query) const
+{
+	return m_directory / (keccak256(m_solvers + "\n" + _query).hex() + ".smt");
+}
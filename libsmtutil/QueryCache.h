@@ -0,0 +1,69 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Content-addressed on-disk cache for the results of SMT queries.
+ */
+
+#pragma once
+
+#include <libsmtutil/SolverInterface.h>
+
+#include <boost/filesystem.hpp>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace solidity::smtutil
+{
+
+/**
+ * Stores the results of SMT queries in a directory, keyed by the hash of the textual
+ * query and a description of the solvers that answered it.
+ *
+ * The description has to contain everything apart from the query that influences
+ * the result, i.e. the names and versions of the solvers and the timeout.
+ * Only definite results (SATISFIABLE and UNSATISFIABLE) are stored.
+ *
+ * Errors while accessing the cache directory are not reported, they just cause a cache miss.
+ * The cache can be used from multiple threads and processes at the same time.
+ */
+class QueryCache
+{
+public:
+	using Result = std::pair<CheckResult, std::vector<std::string>>;
+
+	QueryCache(boost::filesystem::path _directory, std::string _solvers):
+		m_directory(std::move(_directory)),
+		m_solvers(std::move(_solvers))
+	{}
+
+	/// @returns the stored result and model values of @a _query, if present.
+	std::optional<Result> lookup(std::string const& _query) const;
+	/// Stores @a _result as the result of @a _query. Does nothing unless the result is definite.
+	void store(std::string const& _query, Result const& _result) const;
+
+private:
+	boost::filesystem::path entryPath(std::string const& _query) const;
+
+	boost::filesystem::path m_directory;
+	std::string m_solvers;
+};
+
+}
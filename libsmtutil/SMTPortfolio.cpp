@@ -36,38 +36,63 @@ SMTPortfolio::SMTPortfolio(
 	map<h256, string> _smtlib2Responses,
 	frontend::ReadCallback::Callback _smtCallback,
 	[[maybe_unused]] SMTSolverChoice _enabledSolvers,
-	optional<unsigned> _queryTimeout
+	optional<unsigned> _queryTimeout,
+	optional<boost::filesystem::path> _cacheDirectory
 ):
 	SolverInterface(_queryTimeout)
 {
+	// Describes the solvers for the cache, which must not reuse answers from other solvers.
+	string solvers;
 	if (_enabledSolvers.smtlib2)
+	{
 		m_solvers.emplace_back(make_unique<SMTLib2Interface>(move(_smtlib2Responses), move(_smtCallback), m_queryTimeout));
+		solvers += "smtlib2\n";
+	}
 #ifdef HAVE_Z3
 	if (_enabledSolvers.z3 && Z3Interface::available())
+	{
 		m_solvers.emplace_back(make_unique<Z3Interface>(m_queryTimeout));
+		solvers += "z3 " + Z3Interface::version() + "\n";
+	}
 #endif
 #ifdef HAVE_CVC4
 	if (_enabledSolvers.cvc4)
+	{
 		m_solvers.emplace_back(make_unique<CVC4Interface>(m_queryTimeout));
+		solvers += "cvc4 " + CVC4Interface::version() + "\n";
+	}
 #endif
+
+	if (_cacheDirectory && !m_solvers.empty())
+	{
+		solvers += "timeout " + (m_queryTimeout ? to_string(*m_queryTimeout) : string("none"));
+		m_queryCache = make_unique<QueryCache>(move(*_cacheDirectory), move(solvers));
+		m_queryPrinter = make_unique<SMTLib2Interface>(map<h256, string>{}, ReadCallback::Callback{}, m_queryTimeout);
+	}
 }
 
 void SMTPortfolio::reset()
 {
 	for (auto const& s: m_solvers)
 		s->reset();
+	if (m_queryPrinter)
+		m_queryPrinter->reset();
 }
 
 void SMTPortfolio::push()
 {
 	for (auto const& s: m_solvers)
 		s->push();
+	if (m_queryPrinter)
+		m_queryPrinter->push();
 }
 
 void SMTPortfolio::pop()
 {
 	for (auto const& s: m_solvers)
 		s->pop();
+	if (m_queryPrinter)
+		m_queryPrinter->pop();
 }
 
 void SMTPortfolio::declareVariable(string const& _name, SortPointer const& _sort)
@@ -75,12 +100,16 @@ void SMTPortfolio::declareVariable(string const& _name, SortPointer const& _sort
 	smtAssert(_sort, "");
 	for (auto const& s: m_solvers)
 		s->declareVariable(_name, _sort);
+	if (m_queryPrinter)
+		m_queryPrinter->declareVariable(_name, _sort);
 }
 
 void SMTPortfolio::addAssertion(Expression const& _expr)
 {
 	for (auto const& s: m_solvers)
 		s->addAssertion(_expr);
+	if (m_queryPrinter)
+		m_queryPrinter->addAssertion(_expr);
 }
 
 /*
@@ -115,6 +144,20 @@ void SMTPortfolio::addAssertion(Expression const& _expr)
 */
 pair<CheckResult, vector<string>> SMTPortfolio::check(vector<Expression> const& _expressionsToEvaluate)
 {
+	string query;
+	if (m_queryCache)
+	{
+		query = m_queryPrinter->dumpQuery(_expressionsToEvaluate);
+		if (auto cached = m_queryCache->lookup(query))
+		{
+			// The smtlib2 solver hands its queries to the caller, which has to see them
+			// regardless of whether the answer is already known.
+			if (auto smtlib2 = smtlib2Solver())
+				smtlib2->check(_expressionsToEvaluate);
+			return *cached;
+		}
+	}
+
 	CheckResult lastResult = CheckResult::ERROR;
 	vector<string> finalValues;
 	for (auto const& s: m_solvers)
@@ -138,17 +181,25 @@ pair<CheckResult, vector<string>> SMTPortfolio::check(vector<Expression> const&
 		else if (result == CheckResult::UNKNOWN && lastResult == CheckResult::ERROR)
 			lastResult = result;
 	}
+	if (m_queryCache)
+		m_queryCache->store(query, {lastResult, finalValues});
 	return make_pair(lastResult, finalValues);
 }
 
 vector<string> SMTPortfolio::unhandledQueries()
+{
+	if (auto smtlib2 = smtlib2Solver())
+		return smtlib2->unhandledQueries();
+	return {};
+}
+
+SMTLib2Interface* SMTPortfolio::smtlib2Solver() const
 {
 	// This code assumes that the constructor guarantees that
 	// SmtLib2Interface is in position 0, if enabled.
 	if (!m_solvers.empty())
-		if (auto smtlib2 = dynamic_cast<SMTLib2Interface*>(m_solvers.front().get()))
-			return smtlib2->unhandledQueries();
-	return {};
+		return dynamic_cast<SMTLib2Interface*>(m_solvers.front().get());
+	return nullptr;
 }
 
 bool SMTPortfolio::solverAnswered(CheckResult result)
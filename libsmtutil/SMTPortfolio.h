@@ -19,11 +19,17 @@
 #pragma once
 
 
+#include <libsmtutil/QueryCache.h>
+#include <libsmtutil/SMTLib2Interface.h>
 #include <libsmtutil/SolverInterface.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolutil/FixedHash.h>
 
+#include <boost/filesystem.hpp>
+
 #include <map>
+#include <memory>
+#include <optional>
 #include <vector>
 
 namespace solidity::smtutil
@@ -34,6 +40,9 @@ namespace solidity::smtutil
  * propagating the functionalities to all solvers.
  * It also checks whether different solvers give conflicting answers
  * to SMT queries.
+ * If a cache directory is given, definite answers are stored there and
+ * reused for identical queries to the same solvers. Cached queries are still
+ * passed to the smtlib2 solver, so that it can still hand them to the caller.
  */
 class SMTPortfolio: public SolverInterface
 {
@@ -46,7 +55,8 @@ public:
 		std::map<util::h256, std::string> _smtlib2Responses = {},
 		frontend::ReadCallback::Callback _smtCallback = {},
 		SMTSolverChoice _enabledSolvers = SMTSolverChoice::All(),
-		std::optional<unsigned> _queryTimeout = {}
+		std::optional<unsigned> _queryTimeout = {},
+		std::optional<boost::filesystem::path> _cacheDirectory = {}
 	);
 
 	void reset() override;
@@ -64,10 +74,17 @@ public:
 	size_t solvers() override { return m_solvers.size(); }
 private:
 	static bool solverAnswered(CheckResult result);
+	/// @returns the smtlib2 solver, if it is enabled.
+	SMTLib2Interface* smtlib2Solver() const;
 
 	std::vector<std::unique_ptr<SolverInterface>> m_solvers;
 
 	std::vector<Expression> m_assertions;
+
+	std::unique_ptr<QueryCache> m_queryCache;
+	/// Receives the same declarations and assertions as the solvers, to provide the
+	/// textual form of the queries for the cache.
+	std::unique_ptr<SMTLib2Interface> m_queryPrinter;
 };
 
 }
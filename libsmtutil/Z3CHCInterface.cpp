@@ -60,6 +60,7 @@ void Z3CHCInterface::declareVariable(string const& _name, SortPointer const& _so
 void Z3CHCInterface::registerRelation(Expression const& _expr)
 {
 	m_solver.register_relation(m_z3Interface->functions().at(_expr.name));
+	m_relations.emplace_back(_expr.name);
 }
 
 void Z3CHCInterface::addRule(Expression const& _expr, string const& _name)
@@ -75,6 +76,21 @@ void Z3CHCInterface::addRule(Expression const& _expr, string const& _name)
 		z3::expr boundRule = z3::forall(variables, rule);
 		m_solver.add_rule(boundRule, m_context->str_symbol(_name.c_str()));
 	}
+	m_rules.emplace_back(_expr, _name);
+}
+
+string Z3CHCInterface::dumpQuery(Expression const& _expr)
+{
+	try
+	{
+		z3::expr_vector queries(*m_context);
+		queries.push_back(m_z3Interface->toZ3Expr(_expr));
+		return m_solver.to_string(queries);
+	}
+	catch (z3::exception const&)
+	{
+		return {};
+	}
 }
 
 tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> Z3CHCInterface::query(Expression const& _expr)
@@ -128,6 +144,20 @@ tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> Z3CHCInterface::que
 	return {result, Expression(true), {}};
 }
 
+unique_ptr<Z3CHCInterface> Z3CHCInterface::clone() const
+{
+	auto copy = make_unique<Z3CHCInterface>(m_queryTimeout);
+	copy->m_z3Interface->importDeclarations(*m_z3Interface);
+	for (string const& relation: m_relations)
+	{
+		copy->m_solver.register_relation(copy->m_z3Interface->functions().at(relation));
+		copy->m_relations.emplace_back(relation);
+	}
+	for (auto const& [rule, name]: m_rules)
+		copy->addRule(rule, name);
+	return copy;
+}
+
 void Z3CHCInterface::setSpacerOptions(bool _preProcessing)
 {
 	// Spacer options.
@@ -25,6 +25,7 @@
 #include <libsmtutil/CHCSolverInterface.h>
 #include <libsmtutil/Z3Interface.h>
 
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -49,6 +50,14 @@ public:
 
 	void setSpacerOptions(bool _preProcessing = true);
 
+	/// @returns the Horn system together with the query @a _expr in textual form,
+	/// or an empty string if Z3 fails to print it.
+	std::string dumpQuery(Expression const& _expr);
+
+	/// @returns an interface with the same declarations, relations and rules in a new Z3 context.
+	/// The two interfaces can then be queried from different threads.
+	std::unique_ptr<Z3CHCInterface> clone() const;
+
 private:
 	/// Constructs a nonlinear counterexample graph from the refutation.
 	CHCSolverInterface::CexGraph cexGraph(z3::expr const& _proof);
@@ -65,6 +74,11 @@ private:
 	z3::context* m_context;
 	// Horn solver.
 	z3::fixedpoint m_solver;
+	/// Names of the registered relations and the rules added so far, used for cloning.
+	/// The rules are kept untranslated: holding on to their Z3 terms changes which term ids
+	/// Z3 reuses, and with them the search of the solver.
+	std::vector<std::string> m_relations;
+	std::vector<std::pair<Expression, std::string>> m_rules;
 
 	std::tuple<unsigned, unsigned, unsigned, unsigned> m_version = std::tuple(0, 0, 0, 0);
 };
@@ -38,6 +38,11 @@ bool Z3Interface::available()
 #endif
 }
 
+string Z3Interface::version()
+{
+	return Z3_get_full_version();
+}
+
 Z3Interface::Z3Interface(std::optional<unsigned> _queryTimeout):
 	SolverInterface(_queryTimeout),
 	m_solver(m_context)
@@ -58,6 +63,23 @@ void Z3Interface::reset()
 	m_solver.reset();
 }
 
+void Z3Interface::importDeclarations(Z3Interface& _other)
+{
+	smtAssert(&_other.m_context != &m_context, "");
+	for (auto const& [name, constant]: _other.m_constants)
+		m_constants.insert_or_assign(name, translate(constant));
+	for (auto const& [name, function]: _other.m_functions)
+		m_functions.insert_or_assign(name, z3::func_decl(
+			m_context,
+			Z3_to_func_decl(m_context, Z3_translate(_other.m_context, Z3_func_decl_to_ast(_other.m_context, function), m_context))
+		));
+}
+
+z3::expr Z3Interface::translate(z3::expr const& _expr)
+{
+	return z3::expr(m_context, Z3_translate(_expr.ctx(), _expr, m_context));
+}
+
 void Z3Interface::push()
 {
 	m_solver.push();
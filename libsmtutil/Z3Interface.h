@@ -34,6 +34,8 @@ public:
 	Z3Interface(std::optional<unsigned> _queryTimeout = {});
 
 	static bool available();
+	/// @returns the full version string of the Z3 library in use.
+	static std::string version();
 
 	void reset() override;
 
@@ -51,6 +53,12 @@ public:
 	std::map<std::string, z3::expr> constants() const { return m_constants; }
 	std::map<std::string, z3::func_decl> functions() const { return m_functions; }
 
+	/// Declares the constants and functions of @a _other, which must use a different context.
+	/// Neither interface may be used by another thread at the same time.
+	void importDeclarations(Z3Interface& _other);
+	/// @returns @a _expr, which belongs to another context, translated into the context of this interface.
+	z3::expr translate(z3::expr const& _expr);
+
 	z3::context* context() { return &m_context; }
 
 	// Z3 "basic resources" limit.
@@ -24,7 +24,6 @@
 #include <libsolc/libsolc.h>
 #include <libsolidity/interface/StandardCompiler.h>
 #include <libsolidity/interface/Version.h>
-#include <libyul/YulString.h>
 
 #include <cstdlib>
 #include <list>
@@ -153,8 +152,9 @@ extern void solidity_free(char* _data) noexcept
 extern void solidity_reset() noexcept
 {
 	// This is called right before each compilation, but not at the end, so additional memory
-	// can be freed here.
-	yul::YulStringRepository::reset();
+	// can be freed here. Compilations release the Yul strings themselves once no other one is
+	// running, but embedders may have used Yul outside of a compilation since then.
+	yul::YulStringRepository::resetUnlessInSession();
 	solidityAllocations.clear();
 }
 }
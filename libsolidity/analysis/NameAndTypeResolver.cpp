@@ -206,10 +206,11 @@ Declaration const* NameAndTypeResolver::pathFromCurrentScope(vector<ASTString> c
 		return nullptr;
 }
 
-void NameAndTypeResolver::warnHomonymDeclarations() const
+void NameAndTypeResolver::warnHomonymDeclarations(vector<SourceUnit const*> const& _sourceUnits) const
 {
 	DeclarationContainer::Homonyms homonyms;
-	m_scopes.at(nullptr)->populateHomonyms(back_inserter(homonyms));
+	for (SourceUnit const* sourceUnit: _sourceUnits)
+		m_scopes.at(sourceUnit)->populateHomonyms(back_inserter(homonyms));
 
 	for (auto [innerLocation, outerDeclarations]: homonyms)
 	{
@@ -94,8 +94,8 @@ public:
 	/// @note Returns a null pointer if any component in the path was not unique or not found.
 	Declaration const* pathFromCurrentScope(std::vector<ASTString> const& _path) const;
 
-	/// Generate and store warnings about declarations with the same name.
-	void warnHomonymDeclarations() const;
+	/// Generate and store warnings about declarations with the same name in the given source units.
+	void warnHomonymDeclarations(std::vector<SourceUnit const*> const& _sourceUnits) const;
 
 	/// @returns a list of similar identifiers in the current and enclosing scopes. May return empty string if no suggestions.
 	std::string similarNameSuggestions(ASTString const& _name) const;
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <libsolidity/ast/ASTArena.h>
 #include <libsolidity/ast/ASTForward.h>
 #include <libsolidity/ast/Types.h>
 #include <libsolidity/ast/ASTAnnotations.h>
@@ -177,10 +178,17 @@ public:
 	std::optional<std::string> const& licenseString() const { return m_licenseString; }
 	std::vector<ASTPointer<ASTNode>> nodes() const { return m_nodes; }
 
+	/// Makes this source unit own the arena its nodes are allocated from. The source unit
+	/// itself must not be allocated from the arena.
+	void setArena(std::shared_ptr<ASTArena> _arena) { m_arena = std::move(_arena); }
+	ASTArena const* arena() const { return m_arena.get(); }
+
 	/// @returns a set of referenced SourceUnits. Recursively if @a _recurse is true.
 	std::set<SourceUnit const*> referencedSourceUnits(bool _recurse = false, std::set<SourceUnit const*> _skipList = std::set<SourceUnit const*>()) const;
 
 private:
+	/// Declared before the nodes, so that it is destroyed after them.
+	std::shared_ptr<ASTArena> m_arena;
 	std::optional<std::string> m_licenseString;
 	std::vector<ASTPointer<ASTNode>> m_nodes;
 };
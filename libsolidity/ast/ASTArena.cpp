@@ -0,0 +1,61 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/ast/ASTArena.h>
+
+#include <liblangutil/Exceptions.h>
+
+using namespace std;
+using namespace solidity::frontend;
+
+void* ASTArena::allocate(size_t _size, size_t _alignment)
+{
+	solAssert(_alignment <= alignof(max_align_t), "Over-aligned AST allocation.");
+
+	void* current = m_current;
+	if (!align(_alignment, _size, current, m_remaining))
+	{
+		// Objects that would waste a large part of a fresh block get one of their own,
+		// so that the current block can still be used for the following nodes.
+		if (_size > blockSize / 4)
+		{
+			m_blocks.push_back({unique_ptr<byte[]>(new byte[_size]), _size});
+			m_reservedBytes += _size;
+			return m_blocks.back().data.get();
+		}
+		m_blocks.push_back({unique_ptr<byte[]>(new byte[blockSize]), blockSize});
+		m_reservedBytes += blockSize;
+		current = m_blocks.back().data.get();
+		m_remaining = blockSize;
+	}
+
+	m_current = static_cast<byte*>(current) + _size;
+	m_remaining -= _size;
+	return current;
+}
+
+bool ASTArena::owns(void const* _pointer) const
+{
+	// std::less gives a total order even on pointers into different blocks.
+	less<byte const*> const before;
+	auto pointer = static_cast<byte const*>(_pointer);
+	for (Block const& block: m_blocks)
+		if (!before(pointer, block.data.get()) && before(pointer, block.data.get() + block.size))
+			return true;
+	return false;
+}
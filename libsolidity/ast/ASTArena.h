@@ -0,0 +1,97 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Bump allocator for AST nodes.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+/**
+ * Memory region that hands out storage for the nodes of a single AST in large blocks.
+ * Individual allocations are never returned, the whole region is released at once
+ * when the arena is destroyed.
+ * Not thread-safe: an arena is meant to be filled by a single parser or importer.
+ */
+class ASTArena
+{
+public:
+	ASTArena() = default;
+	ASTArena(ASTArena const&) = delete;
+	ASTArena& operator=(ASTArena const&) = delete;
+
+	/// @returns storage for @a _size bytes aligned to @a _alignment.
+	void* allocate(std::size_t _size, std::size_t _alignment);
+
+	/// @returns the number of bytes reserved from the system so far.
+	std::size_t reservedBytes() const { return m_reservedBytes; }
+	/// @returns true if @a _pointer points into storage handed out by this arena.
+	bool owns(void const* _pointer) const;
+
+private:
+	static constexpr std::size_t blockSize = 64 * 1024;
+
+	struct Block
+	{
+		std::unique_ptr<std::byte[]> data;
+		std::size_t size;
+	};
+
+	std::vector<Block> m_blocks;
+	std::byte* m_current = nullptr;
+	std::size_t m_remaining = 0;
+	std::size_t m_reservedBytes = 0;
+};
+
+/**
+ * Standard allocator that takes its storage from an ASTArena. It does not own the arena,
+ * which has to outlive all objects allocated from it. The arena of an AST is owned by its
+ * SourceUnit, so no node may outlive the source unit it belongs to.
+ * Use with std::allocate_shared to place a node and its reference count in the arena.
+ */
+template <class T>
+class ASTArenaAllocator
+{
+public:
+	using value_type = T;
+
+	explicit ASTArenaAllocator(ASTArena* _arena): m_arena(_arena) {}
+	template <class U>
+	ASTArenaAllocator(ASTArenaAllocator<U> const& _other): m_arena(_other.arena()) {}
+
+	T* allocate(std::size_t _n) { return static_cast<T*>(m_arena->allocate(sizeof(T) * _n, alignof(T))); }
+	void deallocate(T*, std::size_t) noexcept {}
+
+	ASTArena* arena() const { return m_arena; }
+
+	template <class U>
+	bool operator==(ASTArenaAllocator<U> const& _other) const { return m_arena == _other.arena(); }
+	template <class U>
+	bool operator!=(ASTArenaAllocator<U> const& _other) const { return m_arena != _other.arena(); }
+
+private:
+	ASTArena* m_arena = nullptr;
+};
+
+}
@@ -63,6 +63,7 @@ map<string, ASTPointer<SourceUnit>> ASTJsonImporter::jsonToSourceUnit(map<string
 	{
 		astAssert(!srcPair.second.isNull());
 		astAssert(member(srcPair.second,"nodeType") == "SourceUnit", "The 'nodeType' of the highest node must be 'SourceUnit'.");
+		m_arena = make_shared<ASTArena>();
 		m_sourceUnits[srcPair.first] = createSourceUnit(srcPair.second, srcPair.first);
 	}
 	return m_sourceUnits;
@@ -80,12 +81,20 @@ ASTPointer<T> ASTJsonImporter::createASTNode(Json::Value const& _node, Args&&...
 
 	astAssert(m_usedIDs.insert(id).second, "Found duplicate node ID!");
 
-	auto n = make_shared<T>(
-		id,
-		createSourceLocation(_node),
-		forward<Args>(_args)...
-	);
-	return n;
+	if constexpr (is_same_v<T, SourceUnit>)
+	{
+		// The source unit owns the arena of its nodes, so it cannot live in it.
+		auto sourceUnit = make_shared<SourceUnit>(id, createSourceLocation(_node), forward<Args>(_args)...);
+		sourceUnit->setArena(move(m_arena));
+		return sourceUnit;
+	}
+	else
+		return allocate_shared<T>(
+			ASTArenaAllocator<T>(m_arena.get()),
+			id,
+			createSourceLocation(_node),
+			forward<Args>(_args)...
+		);
 }
 
 SourceLocation const ASTJsonImporter::createSourceLocation(Json::Value const& _node)
@@ -25,6 +25,7 @@
 
 #include <vector>
 #include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTArena.h>
 #include <json/json.h>
 #include <libsolidity/ast/ASTAnnotations.h>
 #include <liblangutil/EVMVersion.h>
@@ -159,6 +160,9 @@ private:
 	std::map<std::string, ASTPointer<SourceUnit>> m_sourceUnits;
 	/// IDs already used by the nodes
 	std::set<int64_t> m_usedIDs;
+	/// Storage for the nodes of the source unit currently being imported, until it is handed
+	/// over to the source unit
+	std::shared_ptr<ASTArena> m_arena;
 	/// Configured EVM version
 	langutil::EVMVersion m_evmVersion;
 };
@@ -191,10 +191,8 @@ void TypeProvider::reset()
 	clearCaches(instance().m_bytesM);
 	clearCaches(instance().m_magics);
 
-	instance().m_generalTypes.clear();
-	instance().m_stringLiteralTypes.clear();
-	instance().m_ufixedMxN.clear();
-	instance().m_fixedMxN.clear();
+	// Also clears the interned types.
+	instance() = TypeProvider{};
 }
 
 template <typename T, typename... Args>
@@ -204,6 +202,33 @@ inline T const* TypeProvider::createAndGet(Args&& ... _args)
 	return static_cast<T const*>(instance().m_generalTypes.back().get());
 }
 
+template <typename T, typename Key, typename... Args>
+inline T const* TypeProvider::intern(map<Key, T const*>& _types, Key _key, Args&& ... _args)
+{
+	auto it = _types.find(_key);
+	if (it == _types.end())
+		it = _types.emplace(move(_key), createAndGet<T>(std::forward<Args>(_args)...)).first;
+	return it->second;
+}
+
+template <typename T, typename Key>
+inline T const* TypeProvider::internCopy(
+	map<Key, T const*>& _types,
+	Key _key,
+	T const& _type,
+	DataLocation _location,
+	bool _isPointer
+)
+{
+	auto it = _types.find(_key);
+	if (it == _types.end())
+	{
+		instance().m_generalTypes.emplace_back(_type.copyForLocation(_location, _isPointer));
+		it = _types.emplace(move(_key), static_cast<T const*>(instance().m_generalTypes.back().get())).first;
+	}
+	return it->second;
+}
+
 Type const* TypeProvider::fromElementaryTypeName(ElementaryTypeNameToken const& _type, std::optional<StateMutability> _stateMutability)
 {
 	solAssert(
@@ -404,7 +429,7 @@ TupleType const* TypeProvider::tuple(vector<Type const*> members)
 	if (members.empty())
 		return &m_emptyTuple;
 
-	return createAndGet<TupleType>(move(members));
+	return intern(instance().m_tupleTypes, members, members);
 }
 
 ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, DataLocation _location, bool _isPointer)
@@ -412,33 +437,87 @@ ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, Data
 	if (_type->location() == _location && _type->isPointer() == _isPointer)
 		return _type;
 
-	instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
-	return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	// Copies are interned in the same maps as the types that are created directly,
+	// so that equal types are the same object no matter how they were obtained.
+	bool const isPointer = _location != DataLocation::Storage || _isPointer;
+	if (auto const* arrayType = dynamic_cast<ArrayType const*>(_type))
+	{
+		if (arrayType->isByteArray())
+		{
+			if (isPointer)
+				return array(_location, arrayType->isString());
+			return internCopy(
+				arrayType->isString() ? instance().m_stringTypes : instance().m_bytesTypes,
+				make_pair(_location, isPointer),
+				*arrayType,
+				_location,
+				_isPointer
+			);
+		}
+		return internCopy(
+			instance().m_arrayTypes,
+			make_tuple(
+				_location,
+				isPointer,
+				withLocationIfReference(_location, arrayType->baseType()),
+				arrayType->isDynamicallySized() ? optional<u256>{} : make_optional(arrayType->length())
+			),
+			*arrayType,
+			_location,
+			_isPointer
+		);
+	}
+	else if (auto const* structType = dynamic_cast<StructType const*>(_type))
+		return internCopy(
+			instance().m_structTypes,
+			make_tuple(&structType->structDefinition(), _location, isPointer),
+			*structType,
+			_location,
+			_isPointer
+		);
+	solAssert(false, "Unexpected reference type.");
+	return nullptr;
 }
 
 FunctionType const* TypeProvider::function(FunctionDefinition const& _function, FunctionType::Kind _kind)
 {
-	return createAndGet<FunctionType>(_function, _kind);
+	return intern(instance().m_declaredFunctionTypes, make_pair<ASTNode const*>(&_function, _kind), _function, _kind);
 }
 
 FunctionType const* TypeProvider::function(VariableDeclaration const& _varDecl)
 {
-	return createAndGet<FunctionType>(_varDecl);
+	return intern(
+		instance().m_declaredFunctionTypes,
+		make_pair<ASTNode const*>(&_varDecl, FunctionType::Kind::Declaration),
+		_varDecl
+	);
 }
 
 FunctionType const* TypeProvider::function(EventDefinition const& _def)
 {
-	return createAndGet<FunctionType>(_def);
+	return intern(
+		instance().m_declaredFunctionTypes,
+		make_pair<ASTNode const*>(&_def, FunctionType::Kind::Declaration),
+		_def
+	);
 }
 
 FunctionType const* TypeProvider::function(ErrorDefinition const& _def)
 {
-	return createAndGet<FunctionType>(_def);
+	return intern(
+		instance().m_declaredFunctionTypes,
+		make_pair<ASTNode const*>(&_def, FunctionType::Kind::Declaration),
+		_def
+	);
 }
 
 FunctionType const* TypeProvider::function(FunctionTypeName const& _typeName)
 {
-	return createAndGet<FunctionType>(_typeName);
+	return intern(
+		instance().m_declaredFunctionTypes,
+		make_pair<ASTNode const*>(&_typeName, FunctionType::Kind::Declaration),
+		_typeName
+	);
 }
 
 FunctionType const* TypeProvider::function(
@@ -449,7 +528,9 @@ FunctionType const* TypeProvider::function(
 	StateMutability _stateMutability
 )
 {
-	return createAndGet<FunctionType>(
+	return intern(
+		instance().m_namedFunctionTypes,
+		make_tuple(_parameterTypes, _returnParameterTypes, _kind, _arbitraryParameters, _stateMutability),
 		_parameterTypes, _returnParameterTypes,
 		_kind, _arbitraryParameters, _stateMutability
 	);
@@ -470,7 +551,22 @@ FunctionType const* TypeProvider::function(
 	bool _saltSet
 )
 {
-	return createAndGet<FunctionType>(
+	return intern(
+		instance().m_functionTypes,
+		make_tuple(
+			_parameterTypes,
+			_returnParameterTypes,
+			_parameterNames,
+			_returnParameterNames,
+			_kind,
+			_arbitraryParameters,
+			_stateMutability,
+			_declaration,
+			_gasSet,
+			_valueSet,
+			_bound,
+			_saltSet
+		),
 		_parameterTypes,
 		_returnParameterTypes,
 		_parameterNames,
@@ -488,7 +584,7 @@ FunctionType const* TypeProvider::function(
 
 RationalNumberType const* TypeProvider::rationalNumber(rational const& _value, Type const* _compatibleBytesType)
 {
-	return createAndGet<RationalNumberType>(_value, _compatibleBytesType);
+	return intern(instance().m_rationalNumberTypes, make_pair(_value, _compatibleBytesType), _value, _compatibleBytesType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
@@ -506,53 +602,71 @@ ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
 			return bytesStorage();
 		if (_location == DataLocation::Memory)
 			return bytesMemory();
+		if (_location == DataLocation::CallData)
+			return bytesCalldata();
 	}
-	return createAndGet<ArrayType>(_location, _isString);
+	return intern(
+		_isString ? instance().m_stringTypes : instance().m_bytesTypes,
+		make_pair(_location, true),
+		_location,
+		_isString
+	);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType)
 {
-	return createAndGet<ArrayType>(_location, _baseType);
+	return intern(
+		instance().m_arrayTypes,
+		make_tuple(_location, true, withLocationIfReference(_location, _baseType), optional<u256>{}),
+		_location,
+		_baseType
+	);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType, u256 const& _length)
 {
-	return createAndGet<ArrayType>(_location, _baseType, _length);
+	return intern(
+		instance().m_arrayTypes,
+		make_tuple(_location, true, withLocationIfReference(_location, _baseType), make_optional(_length)),
+		_location,
+		_baseType,
+		_length
+	);
 }
 
 ArraySliceType const* TypeProvider::arraySlice(ArrayType const& _arrayType)
 {
-	return createAndGet<ArraySliceType>(_arrayType);
+	return intern(instance().m_arraySliceTypes, &_arrayType, _arrayType);
 }
 
 ContractType const* TypeProvider::contract(ContractDefinition const& _contractDef, bool _isSuper)
 {
-	return createAndGet<ContractType>(_contractDef, _isSuper);
+	return intern(instance().m_contractTypes, make_pair(&_contractDef, _isSuper), _contractDef, _isSuper);
 }
 
 EnumType const* TypeProvider::enumType(EnumDefinition const& _enumDef)
 {
-	return createAndGet<EnumType>(_enumDef);
+	return intern(instance().m_enumTypes, &_enumDef, _enumDef);
 }
 
 ModuleType const* TypeProvider::module(SourceUnit const& _source)
 {
-	return createAndGet<ModuleType>(_source);
+	return intern(instance().m_moduleTypes, &_source, _source);
 }
 
 TypeType const* TypeProvider::typeType(Type const* _actualType)
 {
-	return createAndGet<TypeType>(_actualType);
+	return intern(instance().m_typeTypes, _actualType, _actualType);
 }
 
 StructType const* TypeProvider::structType(StructDefinition const& _struct, DataLocation _location)
 {
-	return createAndGet<StructType>(_struct, _location);
+	return intern(instance().m_structTypes, make_tuple(&_struct, _location, true), _struct, _location);
 }
 
 ModifierType const* TypeProvider::modifier(ModifierDefinition const& _def)
 {
-	return createAndGet<ModifierType>(_def);
+	return intern(instance().m_modifierTypes, &_def, _def);
 }
 
 MagicType const* TypeProvider::magic(MagicType::Kind _kind)
@@ -571,15 +685,15 @@ MagicType const* TypeProvider::meta(Type const* _type)
 		),
 		"Only enum, contracts or integer types supported for now."
 	);
-	return createAndGet<MagicType>(_type);
+	return intern(instance().m_metaTypes, _type, _type);
 }
 
 MappingType const* TypeProvider::mapping(Type const* _keyType, Type const* _valueType)
 {
-	return createAndGet<MappingType>(_keyType, _valueType);
+	return intern(instance().m_mappingTypes, make_pair(_keyType, _valueType), _keyType, _valueType);
 }
 
 UserDefinedValueType const* TypeProvider::userDefinedValueType(UserDefinedValueTypeDefinition const& _definition)
 {
-	return createAndGet<UserDefinedValueType>(_definition);
+	return intern(instance().m_userDefinedValueTypes, &_definition, _definition);
 }
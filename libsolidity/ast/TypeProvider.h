@@ -24,7 +24,9 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -37,6 +39,9 @@ namespace solidity::frontend
  *
  * It is not recommended to explicitly instantiate types unless you really know what and why
  * you are doing it.
+ *
+ * Types are interned: requesting a type with the same arguments twice returns the same pointer,
+ * so that equal types share their members and other cached properties.
  */
 class TypeProvider
 {
@@ -214,6 +219,21 @@ private:
 	template <typename T, typename... Args>
 	static inline T const* createAndGet(Args&& ... _args);
 
+	/// @returns the type stored in @a _types under @a _key, creating it from @a _args if
+	/// it is not present yet.
+	template <typename T, typename Key, typename... Args>
+	static inline T const* intern(std::map<Key, T const*>& _types, Key _key, Args&& ... _args);
+	/// @returns the type stored in @a _types under @a _key, storing a copy of @a _type with the
+	/// given location if it is not present yet.
+	template <typename T, typename Key>
+	static inline T const* internCopy(
+		std::map<Key, T const*>& _types,
+		Key _key,
+		T const& _type,
+		DataLocation _location,
+		bool _isPointer
+	);
+
 	static BoolType const m_boolean;
 	static InaccessibleDynamicType const m_inaccessibleDynamic;
 
@@ -236,6 +256,49 @@ private:
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
 	std::map<std::string, std::unique_ptr<StringLiteralType>> m_stringLiteralTypes{};
 	std::vector<std::unique_ptr<Type>> m_generalTypes{};
+
+	/// Interned types, keyed by the arguments they were created from. They are owned by
+	/// m_generalTypes.
+	/// Reference types are keyed by their location, whether they are pointers and the base type
+	/// in that location, so that copies made by withLocation() are found as well.
+	std::map<std::tuple<DataLocation, bool, Type const*, std::optional<u256>>, ArrayType const*> m_arrayTypes{};
+	std::map<std::pair<DataLocation, bool>, ArrayType const*> m_bytesTypes{};
+	std::map<std::pair<DataLocation, bool>, ArrayType const*> m_stringTypes{};
+	std::map<ArrayType const*, ArraySliceType const*> m_arraySliceTypes{};
+	std::map<std::vector<Type const*>, TupleType const*> m_tupleTypes{};
+	/// Types of functions defined by an AST node. The kind is only relevant for function definitions.
+	std::map<std::pair<ASTNode const*, FunctionType::Kind>, FunctionType const*> m_declaredFunctionTypes{};
+	std::map<
+		std::tuple<strings, strings, FunctionType::Kind, bool, StateMutability>,
+		FunctionType const*
+	> m_namedFunctionTypes{};
+	std::map<
+		std::tuple<
+			TypePointers,
+			TypePointers,
+			strings,
+			strings,
+			FunctionType::Kind,
+			bool,
+			StateMutability,
+			Declaration const*,
+			bool,
+			bool,
+			bool,
+			bool
+		>,
+		FunctionType const*
+	> m_functionTypes{};
+	std::map<std::pair<rational, Type const*>, RationalNumberType const*> m_rationalNumberTypes{};
+	std::map<std::pair<ContractDefinition const*, bool>, ContractType const*> m_contractTypes{};
+	std::map<EnumDefinition const*, EnumType const*> m_enumTypes{};
+	std::map<SourceUnit const*, ModuleType const*> m_moduleTypes{};
+	std::map<Type const*, TypeType const*> m_typeTypes{};
+	std::map<std::tuple<StructDefinition const*, DataLocation, bool>, StructType const*> m_structTypes{};
+	std::map<ModifierDefinition const*, ModifierType const*> m_modifierTypes{};
+	std::map<Type const*, MagicType const*> m_metaTypes{};
+	std::map<std::pair<Type const*, Type const*>, MappingType const*> m_mappingTypes{};
+	std::map<UserDefinedValueTypeDefinition const*, UserDefinedValueType const*> m_userDefinedValueTypes{};
 };
 
 }
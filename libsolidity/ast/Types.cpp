@@ -1603,6 +1603,8 @@ string ArrayType::richIdentifier() const
 
 bool ArrayType::operator==(Type const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	ArrayType const& other = dynamic_cast<ArrayType const&>(_other);
@@ -1942,6 +1944,8 @@ string ArraySliceType::richIdentifier() const
 
 bool ArraySliceType::operator==(Type const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (auto const* other = dynamic_cast<ArraySliceType const*>(&_other))
 		return m_arrayType == other->m_arrayType;
 	return false;
@@ -2091,6 +2095,8 @@ string StructType::richIdentifier() const
 
 bool StructType::operator==(Type const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	StructType const& other = dynamic_cast<StructType const&>(_other);
@@ -2595,6 +2601,8 @@ string TupleType::richIdentifier() const
 
 bool TupleType::operator==(Type const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (auto tupleType = dynamic_cast<TupleType const*>(&_other))
 		return components() == tupleType->components();
 	else
@@ -2954,6 +2962,8 @@ string FunctionType::richIdentifier() const
 
 bool FunctionType::operator==(Type const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	FunctionType const& other = dynamic_cast<FunctionType const&>(_other);
@@ -3648,6 +3658,8 @@ string MappingType::richIdentifier() const
 
 bool MappingType::operator==(Type const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	MappingType const& other = dynamic_cast<MappingType const&>(_other);
@@ -3694,6 +3706,8 @@ string TypeType::richIdentifier() const
 
 bool TypeType::operator==(Type const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	TypeType const& other = dynamic_cast<TypeType const&>(_other);
@@ -28,6 +28,7 @@
 #include <libsolidity/interface/DebugSettings.h>
 #include <liblangutil/EVMVersion.h>
 #include <libevmasm/Assembly.h>
+#include <algorithm>
 #include <functional>
 #include <ostream>
 
@@ -43,6 +44,10 @@ public:
 		m_context(_evmVersion, _revertStrings, &m_runtimeContext)
 	{ }
 
+	/// Sets the maximum number of threads the optimiser may use to optimise sub-assemblies
+	/// concurrently. The result does not depend on this setting.
+	void setOptimiserParallelism(size_t _parallelism) { m_optimiserParallelism = std::max<size_t>(1, _parallelism); }
+
 	/// Compiles a contract.
 	/// @arg _metadata contains the to be injected metadata CBOR
 	void compileContract(
@@ -64,6 +69,7 @@ public:
 
 private:
 	OptimiserSettings const m_optimiserSettings;
+	size_t m_optimiserParallelism = 1;
 	CompilerContext m_runtimeContext;
 	size_t m_runtimeSub = size_t(-1); ///< Identifier of the runtime sub-assembly, if present.
 	CompilerContext m_context;
@@ -25,12 +25,28 @@
 #include <liblangutil/Exceptions.h>
 #include <libsolutil/Whiskers.h>
 #include <libsolutil/StringUtils.h>
+#include <libsolutil/Common.h>
+
+#include <algorithm>
 
 using namespace std;
 using namespace solidity;
 using namespace solidity::frontend;
 using namespace solidity::util;
 
+shared_ptr<SharedYulFunctions::Function const> SharedYulFunctions::find(string const& _name) const
+{
+	lock_guard<mutex> lock(m_mutex);
+	auto it = m_functions.find(_name);
+	return it == m_functions.end() ? nullptr : it->second;
+}
+
+void SharedYulFunctions::store(string const& _name, shared_ptr<Function const> _function)
+{
+	lock_guard<mutex> lock(m_mutex);
+	m_functions.emplace(_name, move(_function));
+}
+
 string MultiUseYulFunctionCollector::requestedFunctions()
 {
 	string result = move(m_code);
@@ -41,6 +57,10 @@ string MultiUseYulFunctionCollector::requestedFunctions()
 
 string MultiUseYulFunctionCollector::createFunction(string const& _name, function<string ()> const& _creator)
 {
+	// The code of a shared function that requests this one cannot be shared.
+	if (!m_sharedFunctionRequests.empty())
+		m_sharedFunctionRequests.back().reset();
+
 	if (!m_requestedFunctions.count(_name))
 	{
 		m_requestedFunctions.insert(_name);
@@ -58,24 +78,86 @@ string MultiUseYulFunctionCollector::createFunction(
 )
 {
 	solAssert(!_name.empty(), "");
-	if (!m_requestedFunctions.count(_name))
+	return createFunction(_name, [&]() { return functionCode(_name, _creator); });
+}
+
+string MultiUseYulFunctionCollector::createSharedFunction(string const& _name, function<string ()> const& _creator)
+{
+	if (!m_sharedFunctions)
+		return createFunction(_name, _creator);
+
+	if (!m_sharedFunctionRequests.empty() && m_sharedFunctionRequests.back())
+		m_sharedFunctionRequests.back()->push_back(_name);
+	if (m_requestedFunctions.count(_name))
+		return _name;
+
+	if (auto sharedFunction = m_sharedFunctions->find(_name))
 	{
-		m_requestedFunctions.insert(_name);
-		vector<string> arguments;
-		vector<string> returnParameters;
-		string body = _creator(arguments, returnParameters);
-		solAssert(!body.empty(), "");
-
-		m_code += Whiskers(R"(
-			function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
-				<body>
-			}
-		)")
-		("functionName", _name)
-		("args", joinHumanReadable(arguments))
-		("retParams", joinHumanReadable(returnParameters))
-		("body", body)
-		.render();
+		addSharedFunction(_name, *sharedFunction);
+		return _name;
 	}
+
+	m_requestedFunctions.insert(_name);
+	m_sharedFunctionRequests.emplace_back(vector<string>{});
+	ScopeGuard popRequests([&]() { m_sharedFunctionRequests.pop_back(); });
+	string fun = _creator();
+	solAssert(!fun.empty(), "");
+	solAssert(fun.find("function " + _name + "(") != string::npos, "Function not properly named.");
+
+	// Replaying the requests of the function must not need the creator of any other function.
+	if (
+		optional<vector<string>> const& requests = m_sharedFunctionRequests.back();
+		requests && all_of(requests->begin(), requests->end(), [&](string const& _request) {
+			return _request == _name || m_sharedFunctions->find(_request);
+		})
+	)
+		m_sharedFunctions->store(_name, make_shared<SharedYulFunctions::Function const>(
+			SharedYulFunctions::Function{fun, *requests}
+		));
+	m_code += move(fun);
 	return _name;
 }
+
+string MultiUseYulFunctionCollector::createSharedFunction(
+	string const& _name,
+	function<string(vector<string>&, vector<string>&)> const& _creator
+)
+{
+	solAssert(!_name.empty(), "");
+	return createSharedFunction(_name, [&]() { return functionCode(_name, _creator); });
+}
+
+void MultiUseYulFunctionCollector::addSharedFunction(string const& _name, SharedYulFunctions::Function const& _function)
+{
+	m_requestedFunctions.insert(_name);
+	for (string const& request: _function.requestedFunctions)
+		if (!m_requestedFunctions.count(request))
+		{
+			auto requestedFunction = m_sharedFunctions->find(request);
+			solAssert(requestedFunction, "");
+			addSharedFunction(request, *requestedFunction);
+		}
+	m_code += _function.code;
+}
+
+string MultiUseYulFunctionCollector::functionCode(
+	string const& _name,
+	function<string(vector<string>&, vector<string>&)> const& _creator
+)
+{
+	vector<string> arguments;
+	vector<string> returnParameters;
+	string body = _creator(arguments, returnParameters);
+	solAssert(!body.empty(), "");
+
+	return Whiskers(R"(
+		function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
+			<body>
+		}
+	)")
+	("functionName", _name)
+	("args", joinHumanReadable(arguments))
+	("retParams", joinHumanReadable(returnParameters))
+	("body", body)
+	.render();
+}
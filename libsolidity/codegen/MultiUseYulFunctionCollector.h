@@ -24,12 +24,41 @@
 
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <set>
+#include <vector>
 
 namespace solidity::frontend
 {
 
+/**
+ * Yul functions generated by MultiUseYulFunctionCollector::createSharedFunction, shared
+ * between the function collectors of all contracts of a compilation.
+ * Must only be used with a single set of compiler settings. Can be shared between threads.
+ */
+class SharedYulFunctions
+{
+public:
+	struct Function
+	{
+		std::string code;
+		/// Names of the shared functions requested while generating the code, in order.
+		std::vector<std::string> requestedFunctions;
+	};
+
+	/// @returns the function called @a _name or nullptr if it has not been stored.
+	std::shared_ptr<Function const> find(std::string const& _name) const;
+	/// Stores @a _function under @a _name unless there already is a function with that name.
+	void store(std::string const& _name, std::shared_ptr<Function const> _function);
+
+private:
+	mutable std::mutex m_mutex;
+	std::map<std::string, std::shared_ptr<Function const>> m_functions;
+};
+
 /**
  * Container of (unparsed) Yul functions identified by name which are meant to be generated
  * only once.
@@ -47,6 +76,16 @@ public:
 		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
 	);
 
+	/// Like createFunction, but for functions whose code only depends on their name and the
+	/// compiler settings. If shared functions are set, the code is taken from there if the
+	/// function was already generated for another contract.
+	std::string createSharedFunction(std::string const& _name, std::function<std::string()> const& _creator);
+
+	std::string createSharedFunction(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+
 	/// @returns concatenation of all generated functions in the order in which they were
 	/// generated.
 	/// Clears the internal list, i.e. calling it again will result in an
@@ -56,9 +95,24 @@ public:
 	/// @returns true IFF a function with the specified name has already been collected.
 	bool contains(std::string const& _name) const { return m_requestedFunctions.count(_name) > 0; }
 
+	void setSharedFunctions(std::shared_ptr<SharedYulFunctions> _sharedFunctions) { m_sharedFunctions = std::move(_sharedFunctions); }
+	std::shared_ptr<SharedYulFunctions> const& sharedFunctions() const { return m_sharedFunctions; }
+
 private:
+	/// Adds the shared function @a _function and the shared functions it requests.
+	void addSharedFunction(std::string const& _name, SharedYulFunctions::Function const& _function);
+
+	static std::string functionCode(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+
 	std::set<std::string> m_requestedFunctions;
 	std::string m_code;
+	std::shared_ptr<SharedYulFunctions> m_sharedFunctions;
+	/// Shared functions requested by each shared function that is currently being generated,
+	/// nullopt if its code cannot be shared because it requested a function that is not shared.
+	std::vector<std::optional<std::vector<std::string>>> m_sharedFunctionRequests;
 };
 
 }
@@ -31,7 +31,9 @@
 #include <libsolidity/codegen/CompilerUtils.h>
 
 #include <libyul/AssemblyStack.h>
+#include <libyul/Object.h>
 #include <libyul/Utilities.h>
+#include <libyul/backends/evm/EVMDialect.h>
 
 #include <libsolutil/Algorithms.h>
 #include <libsolutil/CommonData.h>
@@ -87,21 +89,44 @@ set<CallableDeclaration const*, ASTNode::CompareByID> collectReachableCallables(
 
 }
 
-pair<string, string> IRGenerator::run(
+namespace
+{
+
+string const irWarning =
+	"/*=====================================================*\n"
+	" *                       WARNING                       *\n"
+	" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
+	" *       It can result in LOSS OF FUNDS or worse       *\n"
+	" *                !USE AT YOUR OWN RISK!               *\n"
+	" *=====================================================*/\n\n";
+
+}
+
+string IRGenerator::run(
 	ContractDefinition const& _contract,
 	bytes const& _cborMetadata,
 	map<ContractDefinition const*, string_view const> const& _otherYulSources
 )
 {
-	string const ir = yul::reindent(generate(_contract, _cborMetadata, _otherYulSources));
+	return irWarning + yul::reindent(generate(_contract, _cborMetadata, _otherYulSources));
+}
 
+shared_ptr<yul::Object> IRGenerator::optimize(
+	string const& _ir,
+	langutil::EVMVersion _evmVersion,
+	OptimiserSettings const& _optimiserSettings,
+	langutil::DebugInfoSelection const& _debugInfoSelection,
+	size_t _optimiserParallelism,
+	shared_ptr<yul::OptimisedCodeCache> _optimisedCodeCache
+)
+{
 	yul::AssemblyStack asmStack(
-		m_evmVersion,
+		_evmVersion,
 		yul::AssemblyStack::Language::StrictAssembly,
-		m_optimiserSettings,
-		m_context.debugInfoSelection()
+		_optimiserSettings,
+		_debugInfoSelection
 	);
-	if (!asmStack.parseAndAnalyze("", ir))
+	if (!asmStack.parseAndAnalyze("", _ir))
 	{
 		string errorMessage;
 		for (auto const& error: asmStack.errors())
@@ -109,19 +134,27 @@ pair<string, string> IRGenerator::run(
 				*error,
 				asmStack.charStream("")
 			);
-		solAssert(false, ir + "\n\nInvalid IR generated:\n" + errorMessage + "\n");
+		solAssert(false, _ir + "\n\nInvalid IR generated:\n" + errorMessage + "\n");
 	}
+	asmStack.setOptimiserParallelism(_optimiserParallelism);
+	asmStack.setOptimisedCodeCache(move(_optimisedCodeCache));
 	asmStack.optimize();
 
-	string warning =
-		"/*=====================================================*\n"
-		" *                       WARNING                       *\n"
-		" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
-		" *       It can result in LOSS OF FUNDS or worse       *\n"
-		" *                !USE AT YOUR OWN RISK!               *\n"
-		" *=====================================================*/\n\n";
+	return asmStack.parserResult();
+}
 
-	return {warning + ir, warning + asmStack.print(m_context.soliditySourceProvider())};
+string IRGenerator::print(
+	yul::Object const& _object,
+	langutil::EVMVersion _evmVersion,
+	langutil::DebugInfoSelection const& _debugInfoSelection,
+	langutil::CharStreamProvider const* _soliditySourceProvider
+)
+{
+	return irWarning + _object.toString(
+		&yul::EVMDialect::strictAssemblyForEVMObjects(_evmVersion),
+		_debugInfoSelection,
+		_soliditySourceProvider
+	) + "\n";
 }
 
 string IRGenerator::generate(
@@ -1109,6 +1142,7 @@ void IRGenerator::resetContext(ContractDefinition const& _contract, ExecutionCon
 		m_context.soliditySourceProvider()
 	);
 	newContext.copyFunctionIDsFrom(m_context);
+	newContext.functionCollector().setSharedFunctions(m_context.functionCollector().sharedFunctions());
 	m_context = move(newContext);
 
 	m_context.setMostDerivedContract(_contract);
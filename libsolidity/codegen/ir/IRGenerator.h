@@ -32,8 +32,15 @@
 #include <liblangutil/CharStreamProvider.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <memory>
 #include <string>
 
+namespace solidity::yul
+{
+struct Object;
+class OptimisedCodeCache;
+}
+
 namespace solidity::frontend
 {
 
@@ -50,7 +57,8 @@ public:
 		OptimiserSettings _optimiserSettings,
 		std::map<std::string, unsigned> _sourceIndices,
 		langutil::DebugInfoSelection const& _debugInfoSelection,
-		langutil::CharStreamProvider const* _soliditySourceProvider
+		langutil::CharStreamProvider const* _soliditySourceProvider,
+		std::shared_ptr<SharedYulFunctions> _sharedFunctions = nullptr
 	):
 		m_evmVersion(_evmVersion),
 		m_optimiserSettings(_optimiserSettings),
@@ -64,16 +72,40 @@ public:
 			_soliditySourceProvider
 		),
 		m_utils(_evmVersion, m_context.revertStrings(), m_context.functionCollector())
-	{}
+	{
+		m_context.functionCollector().setSharedFunctions(std::move(_sharedFunctions));
+	}
 
-	/// Generates and returns the IR code, in unoptimized and optimized form
-	/// (or just pretty-printed, depending on the optimizer settings).
-	std::pair<std::string, std::string> run(
+	/// Generates and returns the IR code in unoptimized form.
+	std::string run(
 		ContractDefinition const& _contract,
 		bytes const& _cborMetadata,
 		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
 	);
 
+	/// Validates the IR code @a _ir produced by run() and returns it as analyzed Yul object
+	/// in optimized form (or just parsed, depending on the optimizer settings).
+	/// Does not access the Solidity AST, so it can be called for several contracts concurrently.
+	/// @param _optimiserParallelism maximum number of threads used to optimize the functions of an object.
+	/// @param _optimisedCodeCache if given, the code of objects that were already optimized
+	/// with the same settings, e.g. as part of another contract, is taken from there.
+	static std::shared_ptr<yul::Object> optimize(
+		std::string const& _ir,
+		langutil::EVMVersion _evmVersion,
+		OptimiserSettings const& _optimiserSettings,
+		langutil::DebugInfoSelection const& _debugInfoSelection,
+		size_t _optimiserParallelism = 1,
+		std::shared_ptr<yul::OptimisedCodeCache> _optimisedCodeCache = nullptr
+	);
+
+	/// @returns the pretty-printed form of the object @a _object returned by optimize().
+	static std::string print(
+		yul::Object const& _object,
+		langutil::EVMVersion _evmVersion,
+		langutil::DebugInfoSelection const& _debugInfoSelection,
+		langutil::CharStreamProvider const* _soliditySourceProvider
+	);
+
 private:
 	std::string generate(
 		ContractDefinition const& _contract,
@@ -44,7 +44,13 @@ BMC::BMC(
 	CharStreamProvider const& _charStreamProvider
 ):
 	SMTEncoder(_context, _settings, _errorReporter, _charStreamProvider),
-	m_interface(make_unique<smtutil::SMTPortfolio>(_smtlib2Responses, _smtCallback, _settings.solvers, _settings.timeout))
+	m_interface(make_unique<smtutil::SMTPortfolio>(
+		_smtlib2Responses,
+		_smtCallback,
+		_settings.solvers,
+		_settings.timeout,
+		_settings.cacheDirectory
+	))
 {
 #if defined (HAVE_Z3) || defined (HAVE_CVC4)
 	if (m_settings.solvers.cvc4 || m_settings.solvers.z3)
@@ -1058,6 +1064,8 @@ BMC::checkSatisfiableAndGenerateModel(vector<smtutil::Expression> const& _expres
 {
 	smtutil::CheckResult result;
 	vector<string> values;
+	if (queryDeadlinePassed())
+		return {smtutil::CheckResult::UNKNOWN, {}};
 	try
 	{
 		tie(result, values) = m_interface->check(_expressionsToEvaluate);
@@ -33,6 +33,7 @@
 #include <libsmtutil/CHCSmtLib2Interface.h>
 #include <liblangutil/CharStreamProvider.h>
 #include <libsolutil/Algorithms.h>
+#include <libsolutil/Parallel.h>
 
 #ifdef HAVE_Z3_DLOPEN
 #include <z3_version.h>
@@ -46,6 +47,7 @@
 #include <range/v3/view/reverse.hpp>
 
 #include <charconv>
+#include <mutex>
 #include <queue>
 
 using namespace std;
@@ -62,9 +64,11 @@ CHC::CHC(
 	[[maybe_unused]] map<util::h256, string> const& _smtlib2Responses,
 	[[maybe_unused]] ReadCallback::Callback const& _smtCallback,
 	ModelCheckerSettings const& _settings,
-	CharStreamProvider const& _charStreamProvider
+	CharStreamProvider const& _charStreamProvider,
+	size_t _parallelism
 ):
-	SMTEncoder(_context, _settings, _errorReporter, _charStreamProvider)
+	SMTEncoder(_context, _settings, _errorReporter, _charStreamProvider),
+	m_parallelism(_parallelism)
 {
 	bool usesZ3 = m_settings.solvers.z3;
 #ifdef HAVE_Z3
@@ -74,6 +78,14 @@ CHC::CHC(
 #endif
 	if (!usesZ3 && m_settings.solvers.smtlib2)
 		m_interface = make_unique<CHCSmtLib2Interface>(_smtlib2Responses, _smtCallback, m_settings.timeout);
+#ifdef HAVE_Z3
+	if (usesZ3 && m_settings.cacheDirectory)
+		m_queryCache = make_unique<QueryCache>(
+			*m_settings.cacheDirectory,
+			"z3 " + Z3Interface::version() + " spacer\n" +
+			"timeout " + (m_settings.timeout ? to_string(*m_settings.timeout) : string("none"))
+		);
+#endif
 }
 
 void CHC::analyze(SourceUnit const& _source)
@@ -1532,50 +1544,70 @@ void CHC::addRule(smtutil::Expression const& _rule, string const& _ruleName)
 	m_interface->addRule(_rule, _ruleName);
 }
 
-tuple<CheckResult, smtutil::Expression, CHCSolverInterface::CexGraph> CHC::query(smtutil::Expression const& _query, langutil::SourceLocation const& _location)
+CHC::QueryResult CHC::query(smtutil::Expression const& _query, langutil::SourceLocation const& _location)
+{
+	QueryResult result = solve(*m_interface, _query);
+	reportSolverFailure(get<0>(result), _location);
+	return result;
+}
+
+CHC::QueryResult CHC::solve(
+	CHCSolverInterface& _solver,
+	smtutil::Expression const& _query,
+	[[maybe_unused]] bool _counterexample
+) const
 {
+	if (queryDeadlinePassed())
+		return {CheckResult::UNKNOWN, smtutil::Expression(true), {}};
+
+	// Only proofs are cached, since counterexamples and invariants need the answer of the solver.
+	string cacheKey;
+#ifdef HAVE_Z3
+	if (m_queryCache && m_settings.invariants.invariants.empty())
+		if (auto* z3Solver = dynamic_cast<Z3CHCInterface*>(&_solver))
+		{
+			cacheKey = z3Solver->dumpQuery(_query);
+			auto cached = m_queryCache->lookup(cacheKey);
+			if (cached && cached->first == CheckResult::UNSATISFIABLE)
+				return {CheckResult::UNSATISFIABLE, smtutil::Expression(true), {}};
+		}
+#endif
+
 	CheckResult result;
 	smtutil::Expression invariant(true);
 	CHCSolverInterface::CexGraph cex;
-	tie(result, invariant, cex) = m_interface->query(_query);
-	switch (result)
-	{
-	case CheckResult::SATISFIABLE:
-	{
+	tie(result, invariant, cex) = _solver.query(_query);
+	if (!cacheKey.empty() && result == CheckResult::UNSATISFIABLE)
+		m_queryCache->store(cacheKey, {result, {}});
 #ifdef HAVE_Z3
-		if (m_settings.solvers.z3)
-		{
-			// Even though the problem is SAT, Spacer's pre processing makes counterexamples incomplete.
-			// We now disable those optimizations and check whether we can still solve the problem.
-			auto* spacer = dynamic_cast<Z3CHCInterface*>(m_interface.get());
-			solAssert(spacer, "");
-			spacer->setSpacerOptions(false);
+	if (result == CheckResult::SATISFIABLE && _counterexample && m_settings.solvers.z3)
+	{
+		// Even though the problem is SAT, Spacer's pre processing makes counterexamples incomplete.
+		// We now disable those optimizations and check whether we can still solve the problem.
+		auto* spacer = dynamic_cast<Z3CHCInterface*>(&_solver);
+		solAssert(spacer, "");
+		spacer->setSpacerOptions(false);
 
-			CheckResult resultNoOpt;
-			smtutil::Expression invariantNoOpt(true);
-			CHCSolverInterface::CexGraph cexNoOpt;
-			tie(resultNoOpt, invariantNoOpt, cexNoOpt) = m_interface->query(_query);
+		CheckResult resultNoOpt;
+		smtutil::Expression invariantNoOpt(true);
+		CHCSolverInterface::CexGraph cexNoOpt;
+		tie(resultNoOpt, invariantNoOpt, cexNoOpt) = _solver.query(_query);
 
-			if (resultNoOpt == CheckResult::SATISFIABLE)
-				cex = move(cexNoOpt);
+		if (resultNoOpt == CheckResult::SATISFIABLE)
+			cex = move(cexNoOpt);
 
-			spacer->setSpacerOptions(true);
-		}
-#endif
-		break;
+		spacer->setSpacerOptions(true);
 	}
-	case CheckResult::UNSATISFIABLE:
-		break;
-	case CheckResult::UNKNOWN:
-		break;
-	case CheckResult::CONFLICTING:
+#endif
+	return {result, invariant, cex};
+}
+
+void CHC::reportSolverFailure(CheckResult _result, langutil::SourceLocation const& _location)
+{
+	if (_result == CheckResult::CONFLICTING)
 		m_errorReporter.warning(1988_error, _location, "CHC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
-		break;
-	case CheckResult::ERROR:
+	else if (_result == CheckResult::ERROR)
 		m_errorReporter.warning(1218_error, _location, "CHC: Error trying to invoke SMT solver.");
-		break;
-	}
-	return {result, invariant, cex};
 }
 
 void CHC::verificationTargetEncountered(
@@ -1633,6 +1665,7 @@ void CHC::checkVerificationTargets()
 	}
 
 	set<unsigned> checkedErrorIds;
+	vector<CHCTargetQuery> targetQueries;
 	for (auto const& [targetId, placeholders]: targetEntryPoints)
 	{
 		string errorType;
@@ -1687,10 +1720,34 @@ void CHC::checkVerificationTargets()
 		else
 			solAssert(false, "");
 
-		checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
+		targetQueries.push_back({&target, &placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here."});
 		checkedErrorIds.insert(target.errorId);
 	}
 
+	bool usesZ3 = false;
+#ifdef HAVE_Z3
+	usesZ3 = dynamic_cast<Z3CHCInterface*>(m_interface.get());
+#endif
+	// Most targets are usually safe, which a single query can often show for all of them at once.
+	// Queries with recorded smtlib2 responses must not change, and the invariants of the individual
+	// targets cannot be told apart, so this is only done with z3 and without invariants.
+	if (usesZ3 && m_settings.invariants.invariants.empty())
+		targetQueries = checkTargetsTogether(move(targetQueries));
+
+	if (usesZ3 && m_parallelism > 1 && targetQueries.size() > 1)
+	{
+		// Every copy of the system used for concurrent checking has to contain all error blocks.
+		for (CHCTargetQuery& targetQuery: targetQueries)
+		{
+			createTargetErrorBlock(*targetQuery.target, *targetQuery.placeholders);
+			targetQuery.error = error();
+		}
+		checkTargetsConcurrently(targetQueries);
+	}
+	else
+		for (CHCTargetQuery& targetQuery: targetQueries)
+			checkAndReportTarget(targetQuery);
+
 	auto toReport = m_unsafeTargets;
 	if (m_settings.showUnproved)
 		for (auto const& [node, targets]: m_unprovedTargets)
@@ -1778,17 +1835,18 @@ void CHC::checkVerificationTargets()
 		m_safeTargets[m_verificationTargets.at(id).errorNode].insert(m_verificationTargets.at(id).type);
 }
 
-void CHC::checkAndReportTarget(
-	CHCVerificationTarget const& _target,
-	vector<CHCQueryPlaceholder> const& _placeholders,
-	ErrorId _errorReporterId,
-	string _satMsg,
-	string _unknownMsg
-)
+void CHC::checkAndReportTarget(CHCTargetQuery& _query)
 {
-	if (m_unsafeTargets.count(_target.errorNode) && m_unsafeTargets.at(_target.errorNode).count(_target.type))
+	if (knownUnsafe(*_query.target))
 		return;
 
+	createTargetErrorBlock(*_query.target, *_query.placeholders);
+	_query.error = error();
+	reportTarget(_query, query(_query.error, _query.target->errorNode->location()));
+}
+
+void CHC::createTargetErrorBlock(CHCVerificationTarget const& _target, vector<CHCQueryPlaceholder> const& _placeholders)
+{
 	createErrorBlock();
 	for (auto const& placeholder: _placeholders)
 		connectBlocks(
@@ -1796,11 +1854,21 @@ void CHC::checkAndReportTarget(
 			error(),
 			placeholder.constraints && placeholder.errorExpression == _target.errorId
 		);
-	auto const& location = _target.errorNode->location();
-	auto [result, invariant, model] = query(error(), location);
+}
+
+bool CHC::knownUnsafe(CHCVerificationTarget const& _target) const
+{
+	return m_unsafeTargets.count(_target.errorNode) && m_unsafeTargets.at(_target.errorNode).count(_target.type);
+}
+
+void CHC::reportTarget(CHCTargetQuery const& _query, QueryResult const& _result)
+{
+	CHCVerificationTarget const& target = *_query.target;
+	auto const& [result, invariant, model] = _result;
+	auto const& location = target.errorNode->location();
 	if (result == CheckResult::UNSATISFIABLE)
 	{
-		m_safeTargets[_target.errorNode].insert(_target.type);
+		m_safeTargets[target.errorNode].insert(target.type);
 		set<Predicate const*> predicates;
 		for (auto const* pred: m_interfaces | ranges::views::values)
 			predicates.insert(pred);
@@ -1812,29 +1880,117 @@ void CHC::checkAndReportTarget(
 	}
 	else if (result == CheckResult::SATISFIABLE)
 	{
-		solAssert(!_satMsg.empty(), "");
-		auto cex = generateCounterexample(model, error().name);
+		solAssert(!_query.satMsg.empty(), "");
+		auto cex = generateCounterexample(model, _query.error.name);
 		if (cex)
-			m_unsafeTargets[_target.errorNode][_target.type] = {
-				_errorReporterId,
+			m_unsafeTargets[target.errorNode][target.type] = {
+				_query.errorReporterId,
 				location,
-				"CHC: " + _satMsg + "\nCounterexample:\n" + *cex
+				"CHC: " + _query.satMsg + "\nCounterexample:\n" + *cex
 			};
 		else
-			m_unsafeTargets[_target.errorNode][_target.type] = {
-				_errorReporterId,
+			m_unsafeTargets[target.errorNode][target.type] = {
+				_query.errorReporterId,
 				location,
-				"CHC: " + _satMsg
+				"CHC: " + _query.satMsg
 			};
 	}
-	else if (!_unknownMsg.empty())
-		m_unprovedTargets[_target.errorNode][_target.type] = {
-			_errorReporterId,
+	else if (!_query.unknownMsg.empty())
+		m_unprovedTargets[target.errorNode][target.type] = {
+			_query.errorReporterId,
 			location,
-			"CHC: " + _unknownMsg
+			"CHC: " + _query.unknownMsg
 		};
 }
 
+vector<CHC::CHCTargetQuery> CHC::checkTargetsTogether(vector<CHCTargetQuery> _queries)
+{
+	// With few targets, the combined query does not save enough individual queries to pay
+	// for itself and for the copy of the Horn system it runs on.
+	size_t constexpr minTargetsToCheckTogether = MIN_TARGETS_PLACEHOLDER;
+	if (_queries.size() < minTargetsToCheckTogether)
+		return _queries;
+
+	QueryResult result{CheckResult::UNKNOWN, smtutil::Expression(true), {}};
+#ifdef HAVE_Z3
+	{
+		// Z3's fixedpoint engine has no push/pop, so the error blocks of the batch and the predicate
+		// combining them are added to a fresh copy of the Horn system. The original system stays
+		// the same as without batching and the batches do not see each other's rules.
+		// The new predicates have to be declared in the copy as well.
+		auto* z3Interface = dynamic_cast<Z3CHCInterface*>(m_interface.get());
+		solAssert(z3Interface, "");
+		unique_ptr<Z3CHCInterface> batchZ3Solver = z3Interface->clone();
+		m_context.setSolver(batchZ3Solver->z3Interface());
+		unique_ptr<CHCSolverInterface> batchSolver = move(batchZ3Solver);
+		swap(m_interface, batchSolver);
+		ScopeGuard restoreSolver([&]()
+		{
+			swap(m_interface, batchSolver);
+			m_context.setSolver(z3Interface->z3Interface());
+		});
+
+		Predicate const* anyError = createSymbolicBlock(
+			arity0FunctionSort(),
+			"error_any_" + to_string(m_context.newUniqueId()),
+			PredicateType::Error
+		);
+		m_interface->registerRelation(anyError->functor());
+		for (CHCTargetQuery& targetQuery: _queries)
+		{
+			createTargetErrorBlock(*targetQuery.target, *targetQuery.placeholders);
+			targetQuery.error = error();
+			addRule(smtutil::Expression::implies(targetQuery.error, (*anyError)({})), anyError->functor().name + "_" + targetQuery.error.name);
+		}
+		result = solve(*m_interface, (*anyError)({}), false);
+	}
+#endif
+	if (get<0>(result) == CheckResult::UNSATISFIABLE)
+	{
+		for (CHCTargetQuery const& targetQuery: _queries)
+			reportTarget(targetQuery, {CheckResult::UNSATISFIABLE, get<1>(result), {}});
+		return {};
+	}
+	// At least one of the targets can fail, or the solver gave up. Splitting the batch could cost
+	// almost another query per target, so all of them are checked on their own instead.
+	return _queries;
+}
+
+void CHC::checkTargetsConcurrently(vector<CHCTargetQuery> const& _queries)
+{
+#ifdef HAVE_Z3
+	// Every query is solved in its own copy of the Horn system, so that no query sees the solver
+	// state left behind by another one. This makes the results independent of the number of
+	// threads and of the order in which the queries happen to be picked up.
+	auto* z3Interface = dynamic_cast<Z3CHCInterface*>(m_interface.get());
+	solAssert(z3Interface, "");
+	// Translating reads the original context, which must not happen from two threads at once.
+	mutex cloneMutex;
+	vector<QueryResult> results(_queries.size(), {CheckResult::UNKNOWN, smtutil::Expression(true), {}});
+	util::parallelFor(_queries.size(), m_parallelism, [&](size_t _query) {
+		unique_ptr<Z3CHCInterface> solver;
+		{
+			lock_guard<mutex> lock(cloneMutex);
+			solver = z3Interface->clone();
+		}
+		results[_query] = solve(*solver, _queries[_query].error);
+	});
+
+	// Reporting in the original order makes the result independent of the scheduling.
+	for (size_t i = 0; i < _queries.size(); ++i)
+	{
+		CHCTargetQuery const& targetQuery = _queries[i];
+		if (knownUnsafe(*targetQuery.target))
+			continue;
+		reportSolverFailure(get<0>(results[i]), targetQuery.target->errorNode->location());
+		reportTarget(targetQuery, results[i]);
+	}
+#else
+	solAssert(false, "Concurrent checking requires Z3.");
+	(void)_queries;
+#endif
+}
+
 /**
 The counterexample DAG has the following properties:
 1) The root node represents the reachable error predicate.
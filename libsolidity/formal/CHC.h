@@ -38,6 +38,7 @@
 #include <libsolidity/interface/ReadFile.h>
 
 #include <libsmtutil/CHCSolverInterface.h>
+#include <libsmtutil/QueryCache.h>
 
 #include <liblangutil/SourceLocation.h>
 #include <liblangutil/UniqueErrorReporter.h>
@@ -60,7 +61,8 @@ public:
 		std::map<util::h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback,
 		ModelCheckerSettings const& _settings,
-		langutil::CharStreamProvider const& _charStreamProvider
+		langutil::CharStreamProvider const& _charStreamProvider,
+		size_t _parallelism = 1
 	);
 
 	void analyze(SourceUnit const& _sources);
@@ -245,9 +247,20 @@ private:
 	//@{
 	/// Adds Horn rule to the solver.
 	void addRule(smtutil::Expression const& _rule, std::string const& _ruleName);
+	using QueryResult = std::tuple<smtutil::CheckResult, smtutil::Expression, smtutil::CHCSolverInterface::CexGraph>;
 	/// @returns <true, invariant, empty> if query is unsatisfiable (safe).
 	/// @returns <false, Expression(true), model> otherwise.
-	std::tuple<smtutil::CheckResult, smtutil::Expression, smtutil::CHCSolverInterface::CexGraph> query(smtutil::Expression const& _query, langutil::SourceLocation const& _location);
+	QueryResult query(smtutil::Expression const& _query, langutil::SourceLocation const& _location);
+	/// Sends @a _query to @a _solver without reporting anything, so that it can be called
+	/// from multiple threads with different solvers.
+	/// If @a _counterexample is false, satisfiable queries are not repeated to obtain a complete counterexample.
+	QueryResult solve(
+		smtutil::CHCSolverInterface& _solver,
+		smtutil::Expression const& _query,
+		bool _counterexample = true
+	) const;
+	/// Reports conflicting solver answers and solver errors.
+	void reportSolverFailure(smtutil::CheckResult _result, langutil::SourceLocation const& _location);
 
 	void verificationTargetEncountered(ASTNode const* const _errorNode, VerificationTargetType _type, smtutil::Expression const& _errorCondition);
 
@@ -256,13 +269,23 @@ private:
 	struct CHCVerificationTarget;
 	struct CHCQueryPlaceholder;
 	void checkAssertTarget(ASTNode const* _scope, CHCVerificationTarget const& _target);
-	void checkAndReportTarget(
-		CHCVerificationTarget const& _target,
-		std::vector<CHCQueryPlaceholder> const& _placeholders,
-		langutil::ErrorId _errorReporterId,
-		std::string _satMsg,
-		std::string _unknownMsg = ""
-	);
+	struct CHCTargetQuery;
+	/// Creates the error block of @a _query and checks it, unless its target is already known to be unsafe.
+	void checkAndReportTarget(CHCTargetQuery& _query);
+	/// Creates a new error block that is reachable if @a _target fails in one of @a _placeholders.
+	void createTargetErrorBlock(CHCVerificationTarget const& _target, std::vector<CHCQueryPlaceholder> const& _placeholders);
+	/// @returns true if @a _target was already found to be unsafe through another of its entry points.
+	bool knownUnsafe(CHCVerificationTarget const& _target) const;
+	/// Records the result of @a _query and its invariants or counterexample.
+	void reportTarget(CHCTargetQuery const& _query, QueryResult const& _result);
+	/// Checks whether none of the targets of @a _queries can fail with a single query, if there
+	/// are enough of them. If so, the targets are reported as safe.
+	/// @returns the queries that still have to be checked on their own.
+	std::vector<CHCTargetQuery> checkTargetsTogether(std::vector<CHCTargetQuery> _queries);
+	/// Checks independent targets on multiple threads. Every query is solved in a fresh copy of the
+	/// Horn system, so the results do not depend on the number of threads or on the scheduling.
+	/// They are reported in the order of @a _queries.
+	void checkTargetsConcurrently(std::vector<CHCTargetQuery> const& _queries);
 
 	std::optional<std::string> generateCounterexample(smtutil::CHCSolverInterface::CexGraph const& _graph, std::string const& _root);
 
@@ -362,6 +385,18 @@ private:
 		smtutil::Expression const fromPredicate;
 	};
 
+	/// A verification target and the messages reported if it fails or cannot be proved.
+	struct CHCTargetQuery
+	{
+		CHCVerificationTarget const* target = nullptr;
+		std::vector<CHCQueryPlaceholder> const* placeholders = nullptr;
+		langutil::ErrorId errorReporterId;
+		std::string satMsg;
+		std::string unknownMsg;
+		/// Application of the error predicate that is reachable if the target fails.
+		smtutil::Expression error = smtutil::Expression(true);
+	};
+
 	/// Query placeholders for constructors, if the key has type ContractDefinition*,
 	/// or external functions, if the key has type FunctionDefinition*.
 	/// A placeholder is created for each possible context of a function (e.g. multiple contracts in contract inheritance hierarchy).
@@ -421,6 +456,12 @@ private:
 
 	/// CHC solver.
 	std::unique_ptr<smtutil::CHCSolverInterface> m_interface;
+
+	/// Maximum number of threads that check verification targets at the same time.
+	size_t m_parallelism = 1;
+
+	/// Stores the queries that were proved safe, if a cache directory is given.
+	std::unique_ptr<smtutil::QueryCache> m_queryCache;
 };
 
 }
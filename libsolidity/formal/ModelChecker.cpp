@@ -24,6 +24,8 @@
 #include <range/v3/algorithm/any_of.hpp>
 #include <range/v3/view.hpp>
 
+#include <chrono>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::util;
@@ -35,14 +37,22 @@ ModelChecker::ModelChecker(
 	langutil::CharStreamProvider const& _charStreamProvider,
 	map<h256, string> const& _smtlib2Responses,
 	ModelCheckerSettings _settings,
-	ReadCallback::Callback const& _smtCallback
+	ReadCallback::Callback const& _smtCallback,
+	size_t _parallelism
 ):
 	m_errorReporter(_errorReporter),
 	m_settings(move(_settings)),
 	m_context(),
 	m_bmc(m_context, m_uniqueErrorReporter, _smtlib2Responses, _smtCallback, m_settings, _charStreamProvider),
-	m_chc(m_context, m_uniqueErrorReporter, _smtlib2Responses, _smtCallback, m_settings, _charStreamProvider)
+	m_chc(m_context, m_uniqueErrorReporter, _smtlib2Responses, _smtCallback, m_settings, _charStreamProvider, _parallelism)
 {
+	// The budget is shared by all sources and engines.
+	if (m_settings.timeBudget)
+	{
+		auto deadline = chrono::steady_clock::now() + chrono::milliseconds(*m_settings.timeBudget);
+		m_bmc.setQueryDeadline(deadline);
+		m_chc.setQueryDeadline(deadline);
+	}
 }
 
 // TODO This should be removed for 0.9.0.
@@ -20,6 +20,8 @@
 
 #include <libsmtutil/SolverInterface.h>
 
+#include <boost/filesystem/path.hpp>
+
 #include <optional>
 #include <set>
 
@@ -156,6 +158,11 @@ struct ModelCheckerSettings
 	smtutil::SMTSolverChoice solvers = smtutil::SMTSolverChoice::All();
 	ModelCheckerTargets targets = ModelCheckerTargets::Default();
 	std::optional<unsigned> timeout;
+	/// Time in milliseconds after which all engines stop sending queries to the solvers.
+	/// Targets that have not been checked by then are considered unproved.
+	std::optional<unsigned> timeBudget;
+	/// Directory in which the results of queries are stored and reused by later runs.
+	std::optional<boost::filesystem::path> cacheDirectory;
 
 	bool operator!=(ModelCheckerSettings const& _other) const noexcept { return !(*this == _other); }
 	bool operator==(ModelCheckerSettings const& _other) const noexcept
@@ -168,7 +175,9 @@ struct ModelCheckerSettings
 			showUnproved == _other.showUnproved &&
 			solvers == _other.solvers &&
 			targets == _other.targets &&
-			timeout == _other.timeout;
+			timeout == _other.timeout &&
+			timeBudget == _other.timeBudget &&
+			cacheDirectory == _other.cacheDirectory;
 	}
 };
 
@@ -34,6 +34,8 @@
 #include <libsolidity/interface/ReadFile.h>
 #include <liblangutil/UniqueErrorReporter.h>
 
+#include <chrono>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -129,6 +131,9 @@ public:
 	/// including itself.
 	static std::set<SourceUnit const*, ASTNode::CompareByID> sourceDependencies(SourceUnit const& _source);
 
+	/// Sets the time after which no further solver queries are started.
+	void setQueryDeadline(std::optional<std::chrono::steady_clock::time_point> _deadline) { m_queryDeadline = _deadline; }
+
 protected:
 	void resetSourceAnalysis();
 
@@ -484,6 +489,10 @@ protected:
 
 	ModelCheckerSettings const& m_settings;
 
+	/// Time after which queries are not sent to the solver anymore but considered unknown.
+	std::optional<std::chrono::steady_clock::time_point> m_queryDeadline;
+	bool queryDeadlinePassed() const { return m_queryDeadline && std::chrono::steady_clock::now() >= *m_queryDeadline; }
+
 	/// Character stream for each source,
 	/// used for retrieving source text of expressions for e.g. counter-examples.
 	langutil::CharStreamProvider const& m_charStreamProvider;
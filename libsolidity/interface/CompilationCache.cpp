@@ -0,0 +1,129 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Content-addressed on-disk cache for the output of Standard JSON compilations.
+ */
+
+#include <libsolidity/interface/CompilationCache.h>
+
+#include <libsolidity/interface/Version.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+
+#include <fstream>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::frontend;
+
+namespace fs = boost::filesystem;
+
+optional<Json::Value> CompilationCache::lookup(Json::Value const& _input, ReadCallback::Callback const& _readFile) const
+{
+	Json::Value entry;
+	try
+	{
+		fs::path path = entryPath(_input);
+		if (!fs::exists(path) || !jsonParseStrict(readFileAsString(path), entry))
+			return nullopt;
+	}
+	catch (...)
+	{
+		return nullopt;
+	}
+
+	if (!entry.isObject() || !entry["queries"].isArray() || !entry["output"].isObject())
+		return nullopt;
+
+	for (Json::Value const& query: entry["queries"])
+	{
+		if (!query["kind"].isString() || !query["path"].isString() || !query["success"].isBool() || !query["responseHash"].isString())
+			return nullopt;
+		if (!_readFile)
+			return nullopt;
+		ReadCallback::Result result = _readFile(query["kind"].asString(), query["path"].asString());
+		if (
+			result.success != query["success"].asBool() ||
+			keccak256(result.responseOrErrorMessage).hex() != query["responseHash"].asString()
+		)
+			return nullopt;
+	}
+
+	return entry["output"];
+}
+
+void CompilationCache::store(Json::Value const& _input, vector<Query> const& _queries, Json::Value const& _output) const
+{
+	Json::Value entry{Json::objectValue};
+	entry["queries"] = Json::arrayValue;
+	for (Query const& query: _queries)
+	{
+		Json::Value queryJson{Json::objectValue};
+		queryJson["kind"] = query.kind;
+		queryJson["path"] = query.path;
+		queryJson["success"] = query.success;
+		queryJson["responseHash"] = query.responseHash.hex();
+		entry["queries"].append(move(queryJson));
+	}
+	entry["output"] = _output;
+
+	try
+	{
+		fs::create_directories(m_directory);
+		fs::path path = entryPath(_input);
+		// Write to a temporary file first and rename it, so that concurrent compilations
+		// using the same directory never observe a partially written entry.
+		fs::path temporaryPath = m_directory / fs::unique_path(path.filename().string() + ".%%%%-%%%%-%%%%.tmp");
+		{
+			ofstream file(temporaryPath.string(), ios::binary | ios::trunc);
+			file << jsonCompactPrint(entry);
+			if (!file)
+			{
+				file.close();
+				fs::remove(temporaryPath);
+				return;
+			}
+		}
+		fs::rename(temporaryPath, path);
+	}
+	catch (...)
+	{
+	}
+}
+
+ReadCallback::Callback CompilationCache::recordingCallback(ReadCallback::Callback _readFile, vector<Query>& _queries)
+{
+	if (!_readFile)
+		return {};
+	return [readFile = move(_readFile), &_queries](string const& _kind, string const& _path) {
+		ReadCallback::Result result = readFile(_kind, _path);
+		_queries.push_back({_kind, _path, result.success, keccak256(result.responseOrErrorMessage)});
+		return result;
+	};
+}
+
+fs::path CompilationCache::entryPath(Json::Value const& _input) const
+{
+	// Objects are printed with sorted keys and without whitespace, so that formatting
+	// differences in the input do not affect the key.
+	string key = keccak256(VersionStringStrict + "\n" + jsonCompactPrint(_input)).hex();
+	return m_directory / (key + ".json");
+}
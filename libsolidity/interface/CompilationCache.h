@@ -0,0 +1,79 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Content-addressed on-disk cache for the output of Standard JSON compilations.
+ */
+
+#pragma once
+
+#include <libsolidity/interface/ReadFile.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <json/json.h>
+
+#include <boost/filesystem.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+/**
+ * Stores the output of Standard JSON compilations in a directory, keyed by the hash of
+ * the compiler version and the normalized input.
+ *
+ * Files that are loaded through the read callback are not part of the input, so the
+ * queries made during the compilation are stored together with the output. An entry is
+ * only used if all of these queries still produce the same result.
+ *
+ * Errors while accessing the cache directory are not reported, they just cause a cache miss.
+ */
+class CompilationCache
+{
+public:
+	/// Query that was made through the read callback during a compilation.
+	struct Query
+	{
+		std::string kind;
+		std::string path;
+		bool success;
+		util::h256 responseHash;
+	};
+
+	explicit CompilationCache(boost::filesystem::path _directory): m_directory(std::move(_directory)) {}
+
+	/// @returns the stored output for @a _input, unless it is not present or the result of
+	/// one of the queries made through the read callback has changed since it was stored.
+	std::optional<Json::Value> lookup(Json::Value const& _input, ReadCallback::Callback const& _readFile) const;
+	/// Stores @a _output as the output for @a _input, together with the @a _queries made while
+	/// compiling it.
+	void store(Json::Value const& _input, std::vector<Query> const& _queries, Json::Value const& _output) const;
+
+	/// @returns a callback that forwards to @a _readFile and appends all queries to @a _queries.
+	static ReadCallback::Callback recordingCallback(ReadCallback::Callback _readFile, std::vector<Query>& _queries);
+
+private:
+	boost::filesystem::path entryPath(Json::Value const& _input) const;
+
+	boost::filesystem::path m_directory;
+};
+
+}
@@ -65,6 +65,7 @@
 #include <libyul/AssemblyStack.h>
 #include <libyul/AST.h>
 #include <libyul/AsmParser.h>
+#include <libyul/optimiser/OptimisedCodeCache.h>
 
 #include <liblangutil/Scanner.h>
 #include <liblangutil/SemVerHandler.h>
@@ -75,11 +76,15 @@
 #include <libsolutil/IpfsHash.h>
 #include <libsolutil/JSON.h>
 #include <libsolutil/Algorithms.h>
+#include <libsolutil/Parallel.h>
 
 #include <json/json.h>
 
 #include <boost/algorithm/string/replace.hpp>
 
+#include <algorithm>
+#include <exception>
+#include <functional>
 #include <utility>
 #include <map>
 #include <limits>
@@ -115,7 +120,7 @@ void CompilerStack::createAndAssignCallGraphs()
 {
 	for (Source const* source: m_sourceOrder)
 	{
-		if (!source->ast)
+		if (!source->ast || source->reused)
 			continue;
 
 		for (ContractDefinition const* contract: ASTNode::filteredNodes<ContractDefinition>(source->ast->nodes()))
@@ -150,7 +155,7 @@ void CompilerStack::findAndReportCyclicContractDependencies()
 
 	for (Source const* source: m_sourceOrder)
 	{
-		if (!source->ast)
+		if (!source->ast || source->reused)
 			continue;
 
 		for (ContractDefinition const* contractDefinition: ASTNode::filteredNodes<ContractDefinition>(source->ast->nodes()))
@@ -199,6 +204,105 @@ void CompilerStack::findAndReportCyclicContractDependencies()
 	}
 }
 
+void CompilerStack::storeAnalysisBaseline(shared_ptr<NameAndTypeResolver> _resolver)
+{
+	solAssert(m_incrementalAnalysis && !m_hasError, "");
+
+	AnalysisBaseline baseline;
+	set<Source const*> analysedSources(m_sourceOrder.begin(), m_sourceOrder.end());
+	for (auto const& [name, source]: m_sources)
+		if (analysedSources.count(&source) && source.ast)
+		{
+			baseline.sources[name] = source;
+			baseline.sources[name].reused = false;
+		}
+
+	if (m_analysisBaseline)
+		for (auto const& [name, source]: m_analysisBaseline->sources)
+			if (!baseline.sources.count(name) || baseline.sources.at(name).ast != source.ast)
+				m_retiredASTs.push_back(source.ast);
+
+	baseline.globalContext = m_globalContext;
+	baseline.resolver = move(_resolver);
+	baseline.diagnostics = m_errorList;
+	baseline.evmVersion = m_evmVersion;
+	baseline.remappings = m_importRemapper.remappings();
+	baseline.parserErrorRecovery = m_parserErrorRecovery;
+	baseline.runYulOptimiser = m_optimiserSettings.runYulOptimiser;
+	baseline.modelCheckerSettings = m_modelCheckerSettings;
+	m_analysisBaseline = move(baseline);
+}
+
+void CompilerStack::discardAnalysisBaseline()
+{
+	if (m_analysisBaseline)
+	{
+		m_analysisBaseline.reset();
+		TypeProvider::reset();
+	}
+	m_retiredASTs.clear();
+	m_lastNodeID = 0;
+}
+
+bool CompilerStack::analysisBaselineMatchesSettings() const
+{
+	solAssert(m_analysisBaseline, "");
+	return
+		m_analysisBaseline->evmVersion == m_evmVersion &&
+		m_analysisBaseline->remappings == m_importRemapper.remappings() &&
+		m_analysisBaseline->parserErrorRecovery == m_parserErrorRecovery &&
+		m_analysisBaseline->runYulOptimiser == m_optimiserSettings.runYulOptimiser &&
+		m_analysisBaseline->modelCheckerSettings == m_modelCheckerSettings;
+}
+
+void CompilerStack::mergeReusedDiagnostics()
+{
+	solAssert(m_analysisBaseline, "");
+
+	auto inReusedSource = [&](Error const& _error) {
+		SourceLocation const* location = boost::get_error_info<errinfo_sourceLocation>(_error);
+		if (!location || !location->sourceName)
+			return false;
+		Source const* source = util::valueOrNullptr(m_sources, *location->sourceName);
+		return source && source->reused;
+	};
+
+	// Analysing the changed sources can produce warnings in reused sources again, e.g. for
+	// inherited functions, so they are replaced by the warnings of the full analysis.
+	m_errorList.erase(
+		remove_if(m_errorList.begin(), m_errorList.end(), [&](shared_ptr<Error const> const& _error) {
+			return !Error::isError(_error->type()) && inReusedSource(*_error);
+		}),
+		m_errorList.end()
+	);
+	for (shared_ptr<Error const> const& error: m_analysisBaseline->diagnostics)
+		if (inReusedSource(*error))
+			m_errorList.push_back(error);
+}
+
+void CompilerStack::sortDiagnosticsBySource()
+{
+	map<string, size_t> sourceIndices;
+	for (size_t i = 0; i < m_sourceOrder.size(); ++i)
+		if (m_sourceOrder[i]->ast)
+			sourceIndices[*m_sourceOrder[i]->ast->annotation().path] = i;
+
+	// Diagnostics without a location stay in front.
+	auto sortKey = [&](Error const& _error) -> pair<size_t, int> {
+		SourceLocation const* location = boost::get_error_info<errinfo_sourceLocation>(_error);
+		if (!location || !location->sourceName || !sourceIndices.count(*location->sourceName))
+			return {0, -1};
+		return {sourceIndices.at(*location->sourceName) + 1, location->start};
+	};
+	stable_sort(
+		m_errorList.begin(),
+		m_errorList.end(),
+		[&](shared_ptr<Error const> const& _a, shared_ptr<Error const> const& _b) {
+			return sortKey(*_a) < sortKey(*_b);
+		}
+	);
+}
+
 void CompilerStack::setRemappings(vector<ImportRemapper::Remapping> _remappings)
 {
 	if (m_stackState >= ParsedAndImported)
@@ -279,6 +383,14 @@ void CompilerStack::selectDebugInfo(DebugInfoSelection _debugInfoSelection)
 	m_debugInfoSelection = _debugInfoSelection;
 }
 
+void CompilerStack::setParallelism(size_t _parallelism)
+{
+	if (m_stackState >= CompilationSuccessful)
+		solThrow(CompilerError, "Must set parallelism before compilation.");
+	solAssert(_parallelism > 0, "");
+	m_parallelism = _parallelism;
+}
+
 void CompilerStack::addSMTLib2Response(h256 const& _hash, string const& _response)
 {
 	if (m_stackState >= ParsedAndImported)
@@ -286,8 +398,39 @@ void CompilerStack::addSMTLib2Response(h256 const& _hash, string const& _respons
 	m_smtlib2Responses[_hash] = _response;
 }
 
+void CompilerStack::setIncrementalAnalysis(bool _incrementalAnalysis)
+{
+	if (m_stackState >= ParsedAndImported)
+		solThrow(CompilerError, "Must set incremental analysis before parsing.");
+	m_incrementalAnalysis = _incrementalAnalysis;
+}
+
+void CompilerStack::enableProfiling(bool _enableProfiling)
+{
+	if (m_stackState >= ParsedAndImported)
+		solThrow(CompilerError, "Must enable profiling before parsing.");
+	m_profiler = _enableProfiling ? make_unique<util::Profiler>() : nullptr;
+}
+
 void CompilerStack::reset(bool _keepSettings)
 {
+	if (_keepSettings && m_incrementalAnalysis && m_analysisBaseline)
+	{
+		for (auto const& [name, source]: m_sources)
+			if (
+				source.ast &&
+				(!m_analysisBaseline->sources.count(name) || m_analysisBaseline->sources.at(name).ast != source.ast)
+			)
+				m_retiredASTs.push_back(source.ast);
+		// Retired ASTs and the types referring to them can only be freed together with the
+		// baseline. Once they outnumber the sources of the baseline, the next analysis starts
+		// from scratch, which bounds the memory to about twice the one of a full analysis.
+		if (m_retiredASTs.size() > m_analysisBaseline->sources.size())
+			discardAnalysisBaseline();
+	}
+	else
+		discardAnalysisBaseline();
+
 	m_stackState = Empty;
 	m_hasError = false;
 	m_sources.clear();
@@ -307,12 +450,23 @@ void CompilerStack::reset(bool _keepSettings)
 		m_metadataLiteralSources = false;
 		m_metadataHash = MetadataHash::IPFS;
 		m_stopAfter = State::CompilationSuccessful;
+		m_parallelism = 1;
+		m_incrementalAnalysis = false;
+		m_profiler.reset();
 	}
+	else if (m_profiler)
+		m_profiler = make_unique<util::Profiler>();
 	m_globalContext.reset();
 	m_sourceOrder.clear();
 	m_contracts.clear();
 	m_errorReporter.clear();
-	TypeProvider::reset();
+	// The types and the Yul strings of inline assembly refer to the AST of the baseline,
+	// so they are only released together with it.
+	if (!m_analysisBaseline)
+	{
+		TypeProvider::reset();
+		m_yulStringSession.reset();
+	}
 }
 
 void CompilerStack::setSources(StringMap _sources)
@@ -321,38 +475,53 @@ void CompilerStack::setSources(StringMap _sources)
 		solThrow(CompilerError, "Cannot change sources once set.");
 	if (m_stackState != Empty)
 		solThrow(CompilerError, "Must set sources before parsing.");
-	for (auto source: _sources)
+	for (auto& source: _sources)
 		m_sources[source.first].charStream = make_unique<CharStream>(/*content*/std::move(source.second), /*name*/source.first);
 	m_stackState = SourcesSet;
 }
 
+void CompilerStack::setSources(map<string, util::SharedTextPointer> const& _sources)
+{
+	if (m_stackState == SourcesSet)
+		solThrow(CompilerError, "Cannot change sources once set.");
+	if (m_stackState != Empty)
+		solThrow(CompilerError, "Must set sources before parsing.");
+	for (auto const& [name, text]: _sources)
+		m_sources[name].charStream = make_unique<CharStream>(/*content*/text, /*name*/name);
+	m_stackState = SourcesSet;
+}
+
 bool CompilerStack::parse()
 {
 	if (m_stackState != SourcesSet)
 		solThrow(CompilerError, "Must call parse only after the SourcesSet state.");
 	m_errorReporter.clear();
+	if (!m_yulStringSession)
+		m_yulStringSession.emplace();
+
+	util::Profiler::Activation profilerActivation(m_profiler.get());
+	util::ProfilerScope profilerScope("phase", "parsing");
 
 	if (SemVerVersion{string(VersionString)}.isPrerelease())
 		m_errorReporter.warning(3805_error, "This is a pre-release compiler version, please do not use it in production.");
 
-	Parser parser{m_errorReporter, m_evmVersion, m_parserErrorRecovery};
+	if (m_analysisBaseline && (!m_incrementalAnalysis || !analysisBaselineMatchesSettings()))
+		discardAnalysisBaseline();
 
-	vector<string> sourcesToParse;
-	for (auto const& s: m_sources)
-		sourcesToParse.push_back(s.first);
+	Parser parser{m_errorReporter, m_evmVersion, m_parserErrorRecovery};
+	if (m_analysisBaseline)
+		parser.continueNodeIDsAfter(m_lastNodeID);
 
-	for (size_t i = 0; i < sourcesToParse.size(); ++i)
+	auto parseSource = [&](string const& _path, Source& _source)
 	{
-		string const& path = sourcesToParse[i];
-		Source& source = m_sources[path];
-		source.ast = parser.parse(*source.charStream);
-		if (!source.ast)
+		_source.ast = parser.parse(*_source.charStream);
+		if (!_source.ast)
 			solAssert(Error::containsErrors(m_errorReporter.errors()), "Parser returned null but did not report error.");
 		else
 		{
-			source.ast->annotation().path = path;
+			_source.ast->annotation().path = _path;
 
-			for (auto const& import: ASTNode::filteredNodes<ImportDirective>(source.ast->nodes()))
+			for (auto const& import: ASTNode::filteredNodes<ImportDirective>(_source.ast->nodes()))
 			{
 				solAssert(!import->path().empty(), "Import path cannot be empty.");
 
@@ -361,20 +530,71 @@ bool CompilerStack::parse()
 				// as seen globally.
 				import->annotation().absolutePath = applyRemapping(util::absolutePath(
 					import->path(),
-					path
-				), path);
+					_path
+				), _path);
 			}
+		}
+	};
 
-			if (m_stopAfter >= ParsedAndImported)
-				for (auto const& newSource: loadMissingSources(*source.ast))
-				{
-					string const& newPath = newSource.first;
-					string const& newContents = newSource.second;
-					m_sources[newPath].charStream = make_shared<CharStream>(newContents, newPath);
-					sourcesToParse.push_back(newPath);
-				}
+	// Unchanged sources of the baseline are tentatively reused. Their imports are loaded
+	// like the ones of parsed sources to find out whether they are unchanged as well.
+	bool const reuseAnalysis = m_analysisBaseline && m_stopAfter >= AnalysisPerformed;
+	vector<string> sourcesToParse;
+	for (auto const& s: m_sources)
+		sourcesToParse.push_back(s.first);
+
+	for (size_t i = 0; i < sourcesToParse.size(); ++i)
+	{
+		string const& path = sourcesToParse[i];
+		Source& source = m_sources[path];
+		Source const* baselineSource = reuseAnalysis ? util::valueOrNullptr(m_analysisBaseline->sources, path) : nullptr;
+		if (baselineSource && baselineSource->charStream->source() == source.charStream->source())
+		{
+			source.ast = baselineSource->ast;
+			source.reused = true;
 		}
+		else
+			parseSource(path, source);
+
+		if (source.ast && m_stopAfter >= ParsedAndImported)
+			for (auto const& newSource: loadMissingSources(*source.ast))
+			{
+				string const& newPath = newSource.first;
+				string const& newContents = newSource.second;
+				m_sources[newPath].charStream = make_shared<CharStream>(newContents, newPath);
+				sourcesToParse.push_back(newPath);
+			}
+	}
+
+	if (reuseAnalysis)
+	{
+		// The annotations of a source refer to the ones it imports, so a source can only
+		// be reused if everything it imports is reused as well.
+		bool changed = true;
+		while (changed)
+		{
+			changed = false;
+			for (auto& [path, source]: m_sources)
+				if (source.reused)
+					for (auto const& import: ASTNode::filteredNodes<ImportDirective>(source.ast->nodes()))
+					{
+						auto imported = m_sources.find(*import->annotation().absolutePath);
+						if (imported == m_sources.end() || !imported->second.reused)
+						{
+							source.reused = false;
+							changed = true;
+							break;
+						}
+					}
+		}
+
+		// The imports of the sources that cannot be reused after all have already been loaded.
+		for (auto& [path, source]: m_sources)
+			if (Source const* baselineSource = util::valueOrNullptr(m_analysisBaseline->sources, path))
+				if (!source.reused && source.ast && source.ast == baselineSource->ast)
+					parseSource(path, source);
 	}
+	m_lastNodeID = parser.lastNodeID();
 
 	if (m_stopAfter <= Parsed)
 		m_stackState = Parsed;
@@ -392,6 +612,12 @@ void CompilerStack::importASTs(map<string, Json::Value> const& _sources)
 {
 	if (m_stackState != Empty)
 		solThrow(CompilerError, "Must call importASTs only before the SourcesSet state.");
+	discardAnalysisBaseline();
+	if (!m_yulStringSession)
+		m_yulStringSession.emplace();
+
+	util::Profiler::Activation profilerActivation(m_profiler.get());
+	util::ProfilerScope profilerScope("phase", "AST import");
 	m_sourceJsons = _sources;
 	map<string, ASTPointer<SourceUnit>> reconstructedSources = ASTJsonImporter(m_evmVersion).jsonToSourceUnit(m_sourceJsons);
 	for (auto& src: reconstructedSources)
@@ -415,73 +641,110 @@ bool CompilerStack::analyze()
 {
 	if (m_stackState != ParsedAndImported || m_stackState >= AnalysisPerformed)
 		solThrow(CompilerError, "Must call analyze only after parsing was performed.");
+
+	util::Profiler::Activation profilerActivation(m_profiler.get());
+	util::ProfilerScope profilerScope("phase", "analysis");
+	// Each pass is recorded until the next one starts.
+	optional<util::ProfilerScope> pass;
+	pass.emplace("analysis", "import resolution");
 	resolveImports();
 
+	// Sources reused from the baseline already carry their annotations.
+	vector<Source const*> sourcesToAnalyze;
 	for (Source const* source: m_sourceOrder)
+		if (!source->reused)
+			sourcesToAnalyze.push_back(source);
+
+	pass.emplace("analysis", "scoping");
+	for (Source const* source: sourcesToAnalyze)
 		if (source->ast)
 			Scoper::assignScopes(*source->ast);
 
 	bool noErrors = true;
+	shared_ptr<NameAndTypeResolver> resolverPtr;
 
 	try
 	{
+		pass.emplace("analysis", "syntax checking");
 		SyntaxChecker syntaxChecker(m_errorReporter, m_optimiserSettings.runYulOptimiser);
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !syntaxChecker.checkSyntax(*source->ast))
 				noErrors = false;
 
-		m_globalContext = make_shared<GlobalContext>();
-		// We need to keep the same resolver during the whole process.
-		NameAndTypeResolver resolver(*m_globalContext, m_evmVersion, m_errorReporter);
-		for (Source const* source: m_sourceOrder)
+		pass.emplace("analysis", "declaration registration");
+		// We need to keep the same resolver during the whole process. The annotations of reused
+		// sources refer to the scopes of the resolver and to the global context of the baseline.
+		if (m_analysisBaseline)
+		{
+			m_globalContext = m_analysisBaseline->globalContext;
+			resolverPtr = m_analysisBaseline->resolver;
+		}
+		else
+		{
+			m_globalContext = make_shared<GlobalContext>();
+			resolverPtr = make_shared<NameAndTypeResolver>(*m_globalContext, m_evmVersion, m_errorReporter);
+		}
+		NameAndTypeResolver& resolver = *resolverPtr;
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !resolver.registerDeclarations(*source->ast))
 				return false;
 
 		map<string, SourceUnit const*> sourceUnitsByName;
 		for (auto& source: m_sources)
 			sourceUnitsByName[source.first] = source.second.ast.get();
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !resolver.performImports(*source->ast, sourceUnitsByName))
 				return false;
 
-		resolver.warnHomonymDeclarations();
+		vector<SourceUnit const*> sourceUnitsToAnalyze;
+		for (Source const* source: sourcesToAnalyze)
+			if (source->ast)
+				sourceUnitsToAnalyze.push_back(source->ast.get());
+		resolver.warnHomonymDeclarations(sourceUnitsToAnalyze);
 
+		pass.emplace("analysis", "doc string parsing");
 		DocStringTagParser docStringTagParser(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !docStringTagParser.parseDocStrings(*source->ast))
 				noErrors = false;
 
+		pass.emplace("analysis", "name resolution");
 		// Requires DocStringTagParser
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !resolver.resolveNamesAndTypes(*source->ast))
 				return false;
 
+		pass.emplace("analysis", "declaration type checking");
 		DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !declarationTypeChecker.check(*source->ast))
 				return false;
 
+		pass.emplace("analysis", "doc string validation");
 		// Requires DeclarationTypeChecker to have run
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !docStringTagParser.validateDocStringsUsingTypes(*source->ast))
 				noErrors = false;
 
+		pass.emplace("analysis", "contract level checking");
 		// Next, we check inheritance, overrides, function collisions and other things at
 		// contract or function level.
 		// This also calculates whether a contract is abstract, which is needed by the
 		// type checker.
 		ContractLevelChecker contractLevelChecker(m_errorReporter);
 
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (auto sourceAst = source->ast)
 				noErrors = contractLevelChecker.check(*sourceAst);
 
+		pass.emplace("analysis", "doc string analysis");
 		// Requires ContractLevelChecker
 		DocStringAnalyser docStringAnalyser(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !docStringAnalyser.analyseDocStrings(*source->ast))
 				noErrors = false;
 
+		pass.emplace("analysis", "type checking");
 		// Now we run full type checks that go down to the expression level. This
 		// cannot be done earlier, because we need cross-contract types and information
 		// about whether a contract is abstract for the `new` expression.
@@ -490,15 +753,16 @@ bool CompilerStack::analyze()
 		// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
 		// which is only done one step later.
 		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
-		for (Source const* source: m_sourceOrder)
+		for (Source const* source: sourcesToAnalyze)
 			if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
 				noErrors = false;
 
 		if (noErrors)
 		{
+			pass.emplace("analysis", "post type checking");
 			// Checks that can only be done when all types of all AST nodes are known.
 			PostTypeChecker postTypeChecker(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
+			for (Source const* source: sourcesToAnalyze)
 				if (source->ast && !postTypeChecker.check(*source->ast))
 					noErrors = false;
 			if (!postTypeChecker.finalize())
@@ -508,28 +772,37 @@ bool CompilerStack::analyze()
 		// Create & assign callgraphs and check for contract dependency cycles
 		if (noErrors)
 		{
+			pass.emplace("analysis", "call graph generation");
 			createAndAssignCallGraphs();
 			findAndReportCyclicContractDependencies();
 		}
 
 		if (noErrors)
-			for (Source const* source: m_sourceOrder)
+		{
+			pass.emplace("analysis", "post type contract level checking");
+			for (Source const* source: sourcesToAnalyze)
 				if (source->ast && !PostTypeContractLevelChecker{m_errorReporter}.check(*source->ast))
 					noErrors = false;
+		}
 
 		// Check that immutable variables are never read in c'tors and assigned
 		// exactly once
 		if (noErrors)
-			for (Source const* source: m_sourceOrder)
+		{
+			pass.emplace("analysis", "immutable validation");
+			for (Source const* source: sourcesToAnalyze)
 				if (source->ast)
 					for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 						if (ContractDefinition* contract = dynamic_cast<ContractDefinition*>(node.get()))
 							ImmutableValidator(m_errorReporter, *contract).analyze();
+		}
 
 		if (noErrors)
 		{
+			pass.emplace("analysis", "control flow analysis");
 			// Control flow graph generator and analyzer. It can check for issues such as
 			// variable is used before it is assigned to.
+			// The flows of reused sources are needed to determine which calls always revert.
 			CFG cfg(m_errorReporter);
 			for (Source const* source: m_sourceOrder)
 				if (source->ast && !cfg.constructFlow(*source->ast))
@@ -548,18 +821,20 @@ bool CompilerStack::analyze()
 
 		if (noErrors)
 		{
+			pass.emplace("analysis", "static analysis");
 			// Checks for common mistakes. Only generates warnings.
 			StaticAnalyzer staticAnalyzer(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
+			for (Source const* source: sourcesToAnalyze)
 				if (source->ast && !staticAnalyzer.analyze(*source->ast))
 					noErrors = false;
 		}
 
 		if (noErrors)
 		{
+			pass.emplace("analysis", "view pure checking");
 			// Check for state mutability in every function.
 			vector<ASTPointer<ASTNode>> ast;
-			for (Source const* source: m_sourceOrder)
+			for (Source const* source: sourcesToAnalyze)
 				if (source->ast)
 					ast.push_back(source->ast);
 
@@ -569,11 +844,12 @@ bool CompilerStack::analyze()
 
 		if (noErrors)
 		{
-			ModelChecker modelChecker(m_errorReporter, *this, m_smtlib2Responses, m_modelCheckerSettings, m_readFile);
+			pass.emplace("analysis", "model checking");
+			ModelChecker modelChecker(m_errorReporter, *this, m_smtlib2Responses, m_modelCheckerSettings, m_readFile, m_parallelism);
 			auto allSources = applyMap(m_sourceOrder, [](Source const* _source) { return _source->ast; });
 			modelChecker.enableAllEnginesIfPragmaPresent(allSources);
 			modelChecker.checkRequestedSourcesAndContracts(allSources);
-			for (Source const* source: m_sourceOrder)
+			for (Source const* source: sourcesToAnalyze)
 				if (source->ast)
 					modelChecker.analyze(*source->ast);
 			m_unhandledSMTLib2Queries += modelChecker.unhandledQueries();
@@ -585,10 +861,20 @@ bool CompilerStack::analyze()
 			throw; // Something is weird here, rather throw again.
 		noErrors = false;
 	}
+	pass.reset();
+
+	if (sourcesToAnalyze.size() != m_sourceOrder.size())
+		mergeReusedDiagnostics();
+	// Reused diagnostics are merged at the end, so the order would depend on which sources
+	// were reused otherwise.
+	if (m_incrementalAnalysis)
+		sortDiagnosticsBySource();
 
 	m_stackState = AnalysisPerformed;
 	if (!noErrors)
 		m_hasError = true;
+	else if (m_incrementalAnalysis && !m_hasError)
+		storeAnalysisBaseline(move(resolverPtr));
 
 	return !m_hasError;
 }
@@ -643,63 +929,188 @@ bool CompilerStack::compile(State _stopAfter)
 	if (m_hasError)
 		solThrow(CompilerError, "Called compile with errors.");
 
-	// Only compile contracts individually which have been requested.
-	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	util::Profiler::Activation profilerActivation(m_profiler.get());
+	util::ProfilerScope profilerScope("phase", "code generation");
 
+	// Only compile contracts individually which have been requested.
+	vector<ContractDefinition const*> requestedContracts;
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
 				if (isRequestedContract(*contract))
-				{
-					try
-					{
-						if (m_viaIR || m_generateIR || m_generateEwasm)
-							generateIR(*contract);
-						if (m_generateEvmBytecode)
-						{
-							if (m_viaIR)
-								generateEVMFromIR(*contract);
-							else
-								compileContract(*contract, otherCompilers);
-						}
-						if (m_generateEwasm)
-							generateEwasm(*contract);
-					}
-					catch (Error const& _error)
-					{
-						if (_error.type() != Error::Type::CodeGenerationError)
-							throw;
-						m_errorReporter.error(_error.errorId(), _error.type(), SourceLocation(), _error.what());
-						return false;
-					}
-					catch (UnimplementedFeatureError const& _unimplementedError)
-					{
-						if (
-							SourceLocation const* sourceLocation =
-							boost::get_error_info<langutil::errinfo_sourceLocation>(_unimplementedError)
-						)
-						{
-							string const* comment = _unimplementedError.comment();
-							m_errorReporter.error(
-								1834_error,
-								Error::Type::CodeGenerationError,
-								*sourceLocation,
-								"Unimplemented feature error" +
-								((comment && !comment->empty()) ? ": " + *comment : string{}) +
-								" in " +
-								_unimplementedError.lineInfo()
-							);
-							return false;
-						}
-						else
-							throw;
-					}
-				}
+					requestedContracts.push_back(contract);
+
+	// Contracts created by several others are embedded several times, but optimized only once.
+	m_optimisedCodeCache = make_shared<yul::OptimisedCodeCache>();
+	// Helper functions only depend on their names and the settings, so they are generated once.
+	m_sharedYulFunctions = make_shared<SharedYulFunctions>();
+	bool success =
+		(m_parallelism > 1 && (m_viaIR || m_generateIR || m_generateEwasm)) ?
+		compileContractsInParallel(requestedContracts) :
+		compileContractsSequentially(requestedContracts);
+	m_optimisedCodeCache.reset();
+	m_sharedYulFunctions.reset();
+	if (!success)
+		return false;
+
 	m_stackState = CompilationSuccessful;
 	this->link();
 	return true;
 }
 
+bool CompilerStack::compileContractsSequentially(vector<ContractDefinition const*> const& _contracts)
+{
+	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+
+	for (ContractDefinition const* contract: _contracts)
+	{
+		bool success = reportCodeGenerationErrors([&]() {
+			if (m_viaIR || m_generateIR || m_generateEwasm)
+				generateIR(*contract);
+			if (m_generateEvmBytecode)
+			{
+				if (m_viaIR)
+					generateEVMFromIR(*contract);
+				else
+					compileContract(*contract, otherCompilers);
+			}
+			if (m_generateEwasm)
+				generateEwasm(*contract);
+		});
+		if (!success)
+			return false;
+	}
+	return true;
+}
+
+bool CompilerStack::compileContractsInParallel(vector<ContractDefinition const*> const& _contracts)
+{
+	solAssert(m_viaIR || m_generateIR || m_generateEwasm, "");
+
+	// Generating the IR accesses the AST and the type system, so it is done sequentially
+	// in the usual order. This also generates the dependencies of each contract, so that
+	// their unoptimized IR can be embedded into the contracts that create them.
+	// Diagnostics are kept aside per contract, so that they can be reported in the same
+	// order as in the sequential mode after the remaining steps have run.
+	size_t const errorCount = m_errorList.size();
+	vector<ErrorList> diagnostics(_contracts.size());
+	vector<vector<Contract*>> generatedContracts(_contracts.size());
+	set<Contract const*> scheduledContracts;
+	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	size_t generatedCount = 0;
+	bool generationFailed = false;
+	for (; generatedCount < _contracts.size() && !generationFailed; ++generatedCount)
+	{
+		ContractDefinition const& contract = *_contracts[generatedCount];
+		generationFailed = !reportCodeGenerationErrors([&]() {
+			generateIR(contract, /* _optimize */ false);
+			if (m_generateEvmBytecode && !m_viaIR)
+				compileContract(contract, otherCompilers);
+		});
+
+		for (auto& [name, compiledContract]: m_contracts)
+			if (!compiledContract.yulIR.empty() && scheduledContracts.insert(&compiledContract).second)
+				generatedContracts[generatedCount].push_back(&compiledContract);
+
+		diagnostics[generatedCount] = ErrorList(m_errorList.begin() + static_cast<ptrdiff_t>(errorCount), m_errorList.end());
+		m_errorList.resize(errorCount);
+	}
+
+	// Optimizing the IR and translating it to EVM assembly only works on the Yul code
+	// and contracts do not depend on the results for other contracts, so these steps
+	// are run concurrently. Exceptions are kept per contract and handled in order below.
+	vector<exception_ptr> failures(generatedCount);
+	auto runConcurrently = [&](function<void(size_t)> const& _step)
+	{
+		util::parallelFor(generatedCount, m_parallelism, [&](size_t _index) {
+			if (failures[_index])
+				return;
+			try
+			{
+				_step(_index);
+			}
+			catch (...)
+			{
+				failures[_index] = current_exception();
+			}
+		});
+	};
+	// Threads not needed for separate contracts are used to optimize the functions
+	// of each contract concurrently.
+	size_t optimiserParallelism = max<size_t>(1, m_parallelism / max<size_t>(1, generatedCount));
+	runConcurrently([&](size_t _index) {
+		for (Contract* compiledContract: generatedContracts[_index])
+			optimizeIR(*compiledContract, optimiserParallelism);
+	});
+	if (m_viaIR && m_generateEvmBytecode)
+		runConcurrently([&](size_t _index) {
+			if (!generationFailed || _index + 1 < generatedCount)
+				generateEVMAssemblyFromIR(*_contracts[_index], optimiserParallelism);
+		});
+
+	for (size_t index = 0; index < generatedCount; ++index)
+	{
+		m_errorList += diagnostics[index];
+		if (failures[index])
+		{
+			reportCodeGenerationErrors([&]() { rethrow_exception(failures[index]); });
+			return false;
+		}
+		// The error of a failed IR generation is part of its diagnostics.
+		if (generationFailed && index + 1 == generatedCount)
+			return false;
+
+		ContractDefinition const& contract = *_contracts[index];
+		bool success = reportCodeGenerationErrors([&]() {
+			if (m_viaIR && m_generateEvmBytecode)
+				generateEVMFromIR(contract);
+			if (m_generateEwasm)
+				generateEwasm(contract);
+		});
+		if (!success)
+			return false;
+	}
+	return true;
+}
+
+bool CompilerStack::reportCodeGenerationErrors(function<void()> const& _codeGeneration)
+{
+	try
+	{
+		_codeGeneration();
+	}
+	catch (Error const& _error)
+	{
+		if (_error.type() != Error::Type::CodeGenerationError)
+			throw;
+		m_errorReporter.error(_error.errorId(), _error.type(), SourceLocation(), _error.what());
+		return false;
+	}
+	catch (UnimplementedFeatureError const& _unimplementedError)
+	{
+		if (
+			SourceLocation const* sourceLocation =
+			boost::get_error_info<langutil::errinfo_sourceLocation>(_unimplementedError)
+		)
+		{
+			string const* comment = _unimplementedError.comment();
+			m_errorReporter.error(
+				1834_error,
+				Error::Type::CodeGenerationError,
+				*sourceLocation,
+				"Unimplemented feature error" +
+				((comment && !comment->empty()) ? ": " + *comment : string{}) +
+				" in " +
+				_unimplementedError.lineInfo()
+			);
+			return false;
+		}
+		else
+			throw;
+	}
+	return true;
+}
+
 void CompilerStack::link()
 {
 	solAssert(m_stackState >= CompilationSuccessful, "");
@@ -1125,7 +1536,7 @@ StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast)
 					result = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), importPath);
 
 				if (result.success)
-					newSources[importPath] = result.responseOrErrorMessage;
+					newSources[importPath] = std::move(result.responseOrErrorMessage);
 				else
 				{
 					m_errorReporter.parserError(
@@ -1221,6 +1632,7 @@ void CompilerStack::assemble(
 	solAssert(!m_hasError, "");
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	util::ProfilerScope profilerScope("codegen", "assembly", _contract.fullyQualifiedName());
 
 	compiledContract.evmAssembly = _assembly;
 	solAssert(compiledContract.evmAssembly, "");
@@ -1286,8 +1698,10 @@ void CompilerStack::compileContract(
 		return;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	util::ProfilerScope profilerScope("codegen", "legacy code generation", _contract.fullyQualifiedName());
 
 	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	compiler->setOptimiserParallelism(m_parallelism);
 	compiledContract.compiler = compiler;
 
 	solAssert(!m_viaIR, "");
@@ -1308,7 +1722,7 @@ void CompilerStack::compileContract(
 	assemble(_contract, compiler->assemblyPtr(), compiler->runtimeAssemblyPtr());
 }
 
-void CompilerStack::generateIR(ContractDefinition const& _contract)
+void CompilerStack::generateIR(ContractDefinition const& _contract, bool _optimize)
 {
 	solAssert(m_stackState >= AnalysisPerformed, "");
 	if (m_hasError)
@@ -1328,21 +1742,57 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 
 	string dependenciesSource;
 	for (auto const& [dependency, referencee]: _contract.annotation().contractDependencies)
-		generateIR(*dependency);
+		generateIR(*dependency, _optimize);
 
 	if (!_contract.canBeDeployed())
 		return;
 
+	util::ProfilerScope profilerScope("codegen", "IR generation", _contract.fullyQualifiedName());
 	map<ContractDefinition const*, string_view const> otherYulSources;
 	for (auto const& pair: m_contracts)
 		otherYulSources.emplace(pair.second.contract, pair.second.yulIR);
 
-	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings, sourceIndices(), m_debugInfoSelection, this);
-	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(
+	IRGenerator generator(
+		m_evmVersion,
+		m_revertStrings,
+		m_optimiserSettings,
+		sourceIndices(),
+		m_debugInfoSelection,
+		this,
+		m_sharedYulFunctions
+	);
+	compiledContract.yulIR = generator.run(
 		_contract,
 		createCBORMetadata(compiledContract, /* _forIR */ true),
 		otherYulSources
 	);
+	if (_optimize)
+		optimizeIR(compiledContract);
+}
+
+void CompilerStack::optimizeIR(Contract& _compiledContract, size_t _optimiserParallelism)
+{
+	solAssert(m_stackState >= AnalysisPerformed, "");
+	solAssert(!_compiledContract.yulIR.empty(), "");
+	if (_compiledContract.yulIRIsOptimized)
+		return;
+
+	util::ProfilerScope profilerScope("codegen", "IR optimization", _compiledContract.contract->fullyQualifiedName());
+	shared_ptr<yul::Object> optimizedObject = IRGenerator::optimize(
+		_compiledContract.yulIR,
+		m_evmVersion,
+		m_optimiserSettings,
+		m_debugInfoSelection,
+		_optimiserParallelism,
+		m_optimisedCodeCache
+	);
+	// The textual form is only needed for the output and for the Ewasm translation,
+	// the EVM code transform continues with the object itself.
+	if (m_generateIR || m_generateEwasm)
+		_compiledContract.yulIROptimized = IRGenerator::print(*optimizedObject, m_evmVersion, m_debugInfoSelection, this);
+	if (m_viaIR && m_generateEvmBytecode)
+		_compiledContract.yulIROptimizedObject = std::move(optimizedObject);
+	_compiledContract.yulIRIsOptimized = true;
 }
 
 void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
@@ -1355,18 +1805,39 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 		return;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	solAssert(!compiledContract.yulIROptimized.empty(), "");
 	if (!compiledContract.object.bytecode.empty())
 		return;
 
-	// Re-parse the Yul IR in EVM dialect
+	generateEVMAssemblyFromIR(_contract);
+	assemble(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly);
+}
+
+void CompilerStack::generateEVMAssemblyFromIR(ContractDefinition const& _contract, size_t _optimiserParallelism)
+{
+	solAssert(m_stackState >= AnalysisPerformed, "");
+	if (m_hasError)
+		solThrow(CompilerError, "Called generateEVMAssemblyFromIR with errors.");
+
+	if (!_contract.canBeDeployed())
+		return;
+
+	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	if (compiledContract.evmAssembly)
+		return;
+	solAssert(compiledContract.yulIROptimizedObject, "");
+
+	util::ProfilerScope profilerScope("codegen", "EVM code transform", _contract.fullyQualifiedName());
+	// Continue with the optimized Yul object in EVM dialect. It is optimized further in place
+	// and not needed afterwards.
 	yul::AssemblyStack stack(
 		m_evmVersion,
 		yul::AssemblyStack::Language::StrictAssembly,
 		m_optimiserSettings,
 		m_debugInfoSelection
 	);
-	stack.parseAndAnalyze("", compiledContract.yulIROptimized);
+	stack.setAnalyzedObject(std::move(compiledContract.yulIROptimizedObject));
+	stack.setOptimiserParallelism(_optimiserParallelism);
+	stack.setOptimisedCodeCache(m_optimisedCodeCache);
 	stack.optimize();
 
 	//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
@@ -1374,7 +1845,6 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 	string deployedName = IRNames::deployedObject(_contract);
 	solAssert(!deployedName.empty(), "");
 	tie(compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly) = stack.assembleEVMWithDeployed(deployedName);
-	assemble(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly);
 }
 
 void CompilerStack::generateEwasm(ContractDefinition const& _contract)
@@ -1391,6 +1861,7 @@ void CompilerStack::generateEwasm(ContractDefinition const& _contract)
 	if (!compiledContract.ewasm.empty())
 		return;
 
+	util::ProfilerScope profilerScope("codegen", "Ewasm generation", _contract.fullyQualifiedName());
 	// Re-parse the Yul IR in EVM dialect
 	yul::AssemblyStack stack(
 		m_evmVersion,
@@ -1412,6 +1883,13 @@ void CompilerStack::generateEwasm(ContractDefinition const& _contract)
 	compiledContract.ewasmObject = std::move(*result.bytecode);
 }
 
+Json::Value CompilerStack::profile() const
+{
+	if (!m_profiler)
+		return Json::nullValue;
+	return m_profiler->toJson();
+}
+
 CompilerStack::Contract const& CompilerStack::contract(string const& _contractName) const
 {
 	solAssert(m_stackState >= AnalysisPerformed, "");
@@ -1476,7 +1954,10 @@ string CompilerStack::createMetadata(Contract const& _contract, bool _forIR) con
 		if (optional<string> licenseString = s.second.ast->licenseString())
 			meta["sources"][s.first]["license"] = *licenseString;
 		if (m_metadataLiteralSources)
-			meta["sources"][s.first]["content"] = s.second.charStream->source();
+		{
+			string_view content = s.second.charStream->source();
+			meta["sources"][s.first]["content"] = Json::Value(content.data(), content.data() + content.size());
+		}
 		else
 		{
 			meta["sources"][s.first]["urls"] = Json::arrayValue;
@@ -43,14 +43,20 @@
 
 #include <libevmasm/LinkerObject.h>
 
+#include <libyul/YulString.h>
+
 #include <libsolutil/Common.h>
 #include <libsolutil/FixedHash.h>
 #include <libsolutil/LazyInit.h>
+#include <libsolutil/Profiler.h>
+#include <libsolutil/SharedText.h>
 
 #include <json/json.h>
 
 #include <functional>
+#include <map>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <set>
 #include <string>
@@ -62,6 +68,12 @@ class CharStream;
 }
 
 
+namespace solidity::yul
+{
+struct Object;
+class OptimisedCodeCache;
+}
+
 namespace solidity::evmasm
 {
 class Assembly;
@@ -79,8 +91,10 @@ class FunctionDefinition;
 class SourceUnit;
 class Compiler;
 class GlobalContext;
+class NameAndTypeResolver;
 class Natspec;
 class DeclarationContainer;
+class SharedYulFunctions;
 
 /**
  * Easy to use and self-contained Solidity compiler with as few header dependencies as possible.
@@ -136,6 +150,8 @@ public:
 
 	/// Resets the compiler to an empty state. Unless @a _keepSettings is set to true,
 	/// all settings are reset as well.
+	/// Releases the Yul strings of the compilation unless its analysis is kept for the next one
+	/// or another compilation is still running (see yul::YulStringRepository::Session).
 	void reset(bool _keepSettings = false);
 
 	/// Sets path remappings.
@@ -207,8 +223,33 @@ public:
 	/// Select components of debug info that should be included in comments in generated assembly.
 	void selectDebugInfo(langutil::DebugInfoSelection _debugInfoSelection);
 
+	/// Sets the maximum number of threads used for code generation. With more than one thread,
+	/// the Yul IR of different contracts is optimized and translated to EVM assembly concurrently
+	/// and the sub-assemblies of an EVM assembly are optimized concurrently.
+	/// The output does not depend on this setting. Must be set before compilation.
+	void setParallelism(size_t _parallelism);
+
+	/// Enables reusing the results of the last successful analysis after reset(true).
+	/// Sources whose content and transitive imports are unchanged keep their ASTs and annotations
+	/// and only the remaining sources are parsed and analysed again. The IDs of the AST nodes of
+	/// re-parsed sources differ from the ones of a fresh compilation and warnings located in reused
+	/// sources are taken over from the earlier analysis. Diagnostics are sorted by source and
+	/// position, so their order does not depend on which sources were reused.
+	/// Replaced ASTs are kept in memory until more sources were replaced than the analysis has,
+	/// at which point everything is analysed again.
+	/// Must be set before parsing.
+	void setIncrementalAnalysis(bool _incrementalAnalysis = true);
+
+	/// Enables recording the wall time and the heap allocations of the compilation phases,
+	/// analysis passes, code generation steps per contract and Yul optimiser steps.
+	/// The recording is kept across reset(true). Must be set before parsing.
+	void enableProfiling(bool _enableProfiling = true);
+
 	/// Sets the sources. Must be set before parsing.
 	void setSources(StringMap _sources);
+	/// Sets the sources without copying their text, e.g. for memory-mapped files.
+	/// Must be set before parsing.
+	void setSources(std::map<std::string, util::SharedTextPointer> const& _sources);
 
 	/// Adds a response to an SMTLib2 query (identified by the hash of the query input).
 	/// Must be set before parsing.
@@ -256,6 +297,10 @@ public:
 	/// by calling @a addSMTLib2Response).
 	std::vector<std::string> const& unhandledSMTLib2Queries() const { return m_unhandledSMTLib2Queries; }
 
+	/// @returns the phases recorded since the last reset in the format of util::Profiler::toJson(),
+	/// which can be loaded as a Chrome trace, or null if profiling is not enabled.
+	Json::Value profile() const;
+
 	/// @returns a list of the contract names in the sources.
 	std::vector<std::string> contractNames() const;
 
@@ -269,6 +314,7 @@ public:
 	std::string const& yulIR(std::string const& _contractName) const;
 
 	/// @returns the optimized IR representation of a contract.
+	/// Only available if IR or Ewasm generation was enabled.
 	std::string const& yulIROptimized(std::string const& _contractName) const;
 
 	/// @returns the Ewasm text representation of a contract.
@@ -358,6 +404,8 @@ private:
 		util::h256 mutable keccak256HashCached;
 		util::h256 mutable swarmHashCached;
 		std::string mutable ipfsUrlCached;
+		/// True if the AST and its annotations were taken over from an earlier analysis.
+		bool reused = false;
 		void reset() { *this = Source(); }
 		util::h256 const& keccak256() const;
 		util::h256 const& swarmHash() const;
@@ -374,7 +422,11 @@ private:
 		evmasm::LinkerObject object; ///< Deployment object (includes the runtime sub-object).
 		evmasm::LinkerObject runtimeObject; ///< Runtime object.
 		std::string yulIR; ///< Experimental Yul IR code.
-		std::string yulIROptimized; ///< Optimized experimental Yul IR code.
+		std::string yulIROptimized; ///< Optimized experimental Yul IR code, only if IR output was requested.
+		/// Optimized experimental Yul IR as analyzed object, handed to the EVM code transform.
+		std::shared_ptr<yul::Object> yulIROptimizedObject;
+		/// Whether the IR has been optimized, independently of the forms of it that were kept.
+		bool yulIRIsOptimized = false;
 		std::string ewasm; ///< Experimental Ewasm text representation
 		evmasm::LinkerObject ewasmObject; ///< Experimental Ewasm code
 		util::LazyInit<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
@@ -391,6 +443,36 @@ private:
 	void createAndAssignCallGraphs();
 	void findAndReportCyclicContractDependencies();
 
+	/// Results of a successful analysis that can be reused by incremental analysis.
+	struct AnalysisBaseline
+	{
+		/// The analysed sources.
+		std::map<std::string, Source> sources;
+		std::shared_ptr<GlobalContext> globalContext;
+		std::shared_ptr<NameAndTypeResolver> resolver;
+		/// Diagnostics of parsing and analysis.
+		langutil::ErrorList diagnostics;
+		/// Settings that influence parsing and analysis.
+		langutil::EVMVersion evmVersion;
+		std::vector<ImportRemapper::Remapping> remappings;
+		bool parserErrorRecovery = false;
+		bool runYulOptimiser = false;
+		ModelCheckerSettings modelCheckerSettings;
+	};
+
+	/// Stores the state of the current successful analysis, which used @a _resolver, as baseline
+	/// for the next incremental analysis.
+	void storeAnalysisBaseline(std::shared_ptr<NameAndTypeResolver> _resolver);
+	/// Drops the analysis baseline and everything that is kept alive for it.
+	void discardAnalysisBaseline();
+	/// @returns true if the baseline was created with the same settings that are used now.
+	bool analysisBaselineMatchesSettings() const;
+	/// Replaces warnings located in reused sources by the ones of the analysis baseline.
+	void mergeReusedDiagnostics();
+	/// Sorts the diagnostics by the order of the sources they are located in and by their
+	/// position in the source.
+	void sortDiagnosticsBySource();
+
 	/// Loads the missing sources from @a _ast (named @a _path) using the callback
 	/// @a m_readFile
 	/// @returns the newly loaded sources.
@@ -415,6 +497,20 @@ private:
 		std::shared_ptr<evmasm::Assembly> _runtimeAssembly
 	);
 
+	/// Compiles the given contracts one after another.
+	/// @returns false if code generation failed.
+	bool compileContractsSequentially(std::vector<ContractDefinition const*> const& _contracts);
+
+	/// Compiles the given contracts, running the steps that only operate on Yul code concurrently.
+	/// Produces the same output and diagnostics as compileContractsSequentially.
+	/// @returns false if code generation failed.
+	bool compileContractsInParallel(std::vector<ContractDefinition const*> const& _contracts);
+
+	/// Runs @a _codeGeneration and reports code generation errors and unimplemented features
+	/// thrown by it. Other exceptions are propagated.
+	/// @returns false if an error was reported.
+	bool reportCodeGenerationErrors(std::function<void()> const& _codeGeneration);
+
 	/// Compile a single contract.
 	/// @param _otherCompilers provides access to compilers of other contracts, to get
 	///                        their bytecode if needed. Only filled after they have been compiled.
@@ -425,12 +521,22 @@ private:
 
 	/// Generate Yul IR for a single contract.
 	/// The IR is stored but otherwise unused.
-	void generateIR(ContractDefinition const& _contract);
+	/// @param _optimize if false, the IR is only generated and optimizeIR has to be called later.
+	void generateIR(ContractDefinition const& _contract, bool _optimize = true);
+
+	/// Validates and optimizes the IR generated by generateIR.
+	/// Only accesses the given contract, so it can run concurrently for different contracts.
+	/// @param _optimiserParallelism maximum number of threads used to optimize the functions of an object.
+	void optimizeIR(Contract& _compiledContract, size_t _optimiserParallelism = 1);
 
 	/// Generate EVM representation for a single contract.
 	/// Depends on output generated by generateIR.
 	void generateEVMFromIR(ContractDefinition const& _contract);
 
+	/// Translates the optimized IR of a single contract to EVM assembly without assembling it.
+	/// Only operates on the Yul code, so it can run concurrently for different contracts.
+	void generateEVMAssemblyFromIR(ContractDefinition const& _contract, size_t _optimiserParallelism = 1);
+
 	/// Generate Ewasm representation for a single contract.
 	/// Depends on output generated by generateIR.
 	void generateEwasm(ContractDefinition const& _contract);
@@ -483,10 +589,18 @@ private:
 		FunctionDefinition const& _function
 	) const;
 
+	/// Keeps the Yul strings of the compilation from being reclaimed from parsing until reset()
+	/// discards everything that refers to them. Declared first, so that it is destroyed last.
+	std::optional<yul::YulStringRepository::Session> m_yulStringSession;
 	ReadCallback::Callback m_readFile;
 	OptimiserSettings m_optimiserSettings;
 	RevertStrings m_revertStrings = RevertStrings::Default;
 	State m_stopAfter = State::CompilationSuccessful;
+	size_t m_parallelism = 1;
+	/// Optimized code of Yul objects, shared by the contracts of one compilation.
+	std::shared_ptr<yul::OptimisedCodeCache> m_optimisedCodeCache;
+	/// Yul helper functions generated for the IR, shared by the contracts of one compilation.
+	std::shared_ptr<SharedYulFunctions> m_sharedYulFunctions;
 	bool m_viaIR = false;
 	langutil::EVMVersion m_evmVersion;
 	ModelCheckerSettings m_modelCheckerSettings;
@@ -513,6 +627,16 @@ private:
 	bool m_parserErrorRecovery = false;
 	State m_stackState = Empty;
 	bool m_importedSources = false;
+	bool m_incrementalAnalysis = false;
+	std::optional<AnalysisBaseline> m_analysisBaseline;
+	/// ASTs of replaced sources. They are kept alive as long as there is a baseline, since the
+	/// name resolver and the types created during earlier analyses can still refer to them.
+	/// The baseline is discarded once there are more of them than sources in the baseline.
+	std::vector<std::shared_ptr<SourceUnit>> m_retiredASTs;
+	/// Records the phases of the compilation if profiling is enabled.
+	std::unique_ptr<util::Profiler> m_profiler;
+	/// ID of the last AST node created while there was a baseline.
+	int64_t m_lastNodeID = 0;
 	/// Whether or not there has been an error during processing.
 	/// If this is true, the stack will refuse to generate code.
 	bool m_hasError = false;
@@ -33,8 +33,9 @@
 using solidity::frontend::ReadCallback;
 using solidity::langutil::InternalCompilerError;
 using solidity::util::errinfo_comment;
-using solidity::util::readFileAsString;
 using solidity::util::joinHumanReadable;
+using solidity::util::SharedText;
+using solidity::util::SharedTextPointer;
 using std::map;
 using std::reference_wrapper;
 using std::string;
@@ -84,19 +85,34 @@ void FileReader::allowDirectory(boost::filesystem::path _path)
 	m_allowedDirectories.insert(std::move(_path));
 }
 
+FileReader::StringMap FileReader::sourceCodes() const
+{
+	StringMap sourceCodes;
+	for (auto const& [sourceUnitName, source]: m_sourceCodes)
+		sourceCodes.emplace(sourceUnitName, string(source->view()));
+	return sourceCodes;
+}
+
 void FileReader::setSource(boost::filesystem::path const& _path, SourceCode _source)
+{
+	setSource(_path, SharedText::fromString(std::move(_source)));
+}
+
+void FileReader::setSource(boost::filesystem::path const& _path, SharedTextPointer _source)
 {
 	m_sourceCodes[cliPathToSourceUnitName(_path)] = std::move(_source);
 }
 
 void FileReader::setStdin(SourceCode _source)
 {
-	m_sourceCodes["<stdin>"] = std::move(_source);
+	m_sourceCodes["<stdin>"] = SharedText::fromString(std::move(_source));
 }
 
 void FileReader::setSources(StringMap _sources)
 {
-	m_sourceCodes = std::move(_sources);
+	m_sourceCodes.clear();
+	for (auto& [sourceUnitName, source]: _sources)
+		m_sourceCodes.emplace(sourceUnitName, SharedText::fromString(std::move(source)));
 }
 
 ReadCallback::Result FileReader::readFile(string const& _kind, string const& _sourceUnitName)
@@ -153,10 +169,10 @@ ReadCallback::Result FileReader::readFile(string const& _kind, string const& _so
 			return ReadCallback::Result{false, "Not a valid file."};
 
 		// NOTE: we ignore the FileNotFound exception as we manually check above
-		auto contents = readFileAsString(candidates[0]);
+		SharedTextPointer contents = SharedText::fromFile(candidates[0]);
 		solAssert(m_sourceCodes.count(_sourceUnitName) == 0, "");
 		m_sourceCodes[_sourceUnitName] = contents;
-		return ReadCallback::Result{true, contents};
+		return ReadCallback::Result{true, string(contents->view())};
 	}
 	catch (util::Exception const& _exception)
 	{
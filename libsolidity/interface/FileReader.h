@@ -20,10 +20,13 @@
 #include <libsolidity/interface/ImportRemapper.h>
 #include <libsolidity/interface/ReadFile.h>
 
+#include <libsolutil/SharedText.h>
+
 #include <boost/filesystem.hpp>
 
 #include <map>
 #include <set>
+#include <string_view>
 
 namespace solidity::frontend
 {
@@ -36,6 +39,7 @@ class FileReader
 {
 public:
 	using StringMap = std::map<SourceUnitName, SourceCode>;
+	using SharedTextMap = std::map<SourceUnitName, util::SharedTextPointer>;
 	using PathMap = std::map<SourceUnitName, boost::filesystem::path>;
 	using FileSystemPathSet = std::set<boost::filesystem::path>;
 
@@ -61,10 +65,14 @@ public:
 	void allowDirectory(boost::filesystem::path _path);
 	FileSystemPathSet const& allowedDirectories() const noexcept { return m_allowedDirectories; }
 
-	StringMap const& sourceCodes() const noexcept { return m_sourceCodes; }
+	/// @returns the loaded sources without copying their text.
+	SharedTextMap const& sharedSourceCodes() const noexcept { return m_sourceCodes; }
+
+	/// @returns a copy of the loaded sources. Prefer @a sharedSourceCodes() where possible.
+	StringMap sourceCodes() const;
 
 	/// Retrieves the source code for a given source unit name.
-	SourceCode const& sourceCode(SourceUnitName const& _sourceUnitName) const { return m_sourceCodes.at(_sourceUnitName); }
+	std::string_view sourceCode(SourceUnitName const& _sourceUnitName) const { return m_sourceCodes.at(_sourceUnitName)->view(); }
 
 	/// Resets all sources to the given map of source unit name to source codes.
 	/// Does not enforce @a allowedDirectories().
@@ -73,6 +81,7 @@ public:
 	/// Adds the source code under a source unit name created by normalizing the file path.
 	/// Does not enforce @a allowedDirectories().
 	void setSource(boost::filesystem::path const& _path, SourceCode _source);
+	void setSource(boost::filesystem::path const& _path, util::SharedTextPointer _source);
 
 	/// Adds the source code under the source unit name of @a <stdin>.
 	/// Does not enforce @a allowedDirectories().
@@ -82,9 +91,10 @@ public:
 	/// and attempts to interpret it as a path and read the corresponding file from disk.
 	/// The read will only succeed if the canonical path of the file is within one of the @a allowedDirectories().
 	/// @param _kind must be equal to "source". Other values are not supported.
-	/// @return Content of the loaded file or an error message. If the operation succeeds, a copy of
-	/// the content is retained in @a sourceCodes() under the key of @a _sourceUnitName. If the key
-	/// already exists, previous content is discarded.
+	/// @return Content of the loaded file or an error message. If the operation succeeds, the
+	/// content is retained in @a sourceCodes() under the key of @a _sourceUnitName. Large files are
+	/// retained as a memory mapping rather than being read, so they must not be truncated or
+	/// rewritten while the reader is in use (see util::SharedText::fromFile).
 	frontend::ReadCallback::Result readFile(std::string const& _kind, std::string const& _sourceUnitName);
 
 	frontend::ReadCallback::Callback reader()
@@ -154,8 +164,8 @@ private:
 	/// list of allowed directories to read files from
 	FileSystemPathSet m_allowedDirectories;
 
-	/// map of input files to source code strings
-	StringMap m_sourceCodes;
+	/// map of input files to source code texts
+	SharedTextMap m_sourceCodes;
 };
 
 }
@@ -23,6 +23,7 @@
 
 #include <libsolidity/interface/StandardCompiler.h>
 #include <libsolidity/interface/ImportRemapper.h>
+#include <libsolidity/interface/CompilationCache.h>
 
 #include <libsolidity/ast/ASTJsonConverter.h>
 #include <libyul/AssemblyStack.h>
@@ -38,6 +39,7 @@
 #include <libsolutil/JSON.h>
 #include <libsolutil/Keccak256.h>
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Parallel.h>
 
 #include <boost/algorithm/string/predicate.hpp>
 
@@ -439,13 +441,13 @@ std::optional<Json::Value> checkAuxiliaryInputKeys(Json::Value const& _input)
 
 std::optional<Json::Value> checkSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "stopAfter", "viaIR"};
+	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "parallelism", "profile", "remappings", "stopAfter", "viaIR"};
 	return checkKeys(_input, keys, "settings");
 }
 
 std::optional<Json::Value> checkModelCheckerSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"contracts", "divModNoSlacks", "engine", "invariants", "showUnproved", "solvers", "targets", "timeout"};
+	static set<string> keys{"contracts", "divModNoSlacks", "engine", "invariants", "showUnproved", "solvers", "targets", "timeBudget", "timeout"};
 	return checkKeys(_input, keys, "modelChecker");
 }
 
@@ -785,6 +787,21 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.viaIR = settings["viaIR"].asBool();
 	}
 
+	if (settings.isMember("parallelism"))
+	{
+		if (!settings["parallelism"].isUInt())
+			return formatFatalError("JSONError", "\"settings.parallelism\" must be an unsigned integer.");
+		unsigned parallelism = settings["parallelism"].asUInt();
+		ret.parallelism = (parallelism == 0 ? util::defaultParallelism() : parallelism);
+	}
+
+	if (settings.isMember("profile"))
+	{
+		if (!settings["profile"].isBool())
+			return formatFatalError("JSONError", "\"settings.profile\" must be a Boolean.");
+		ret.profile = settings["profile"].asBool();
+	}
+
 	if (settings.isMember("evmVersion"))
 	{
 		if (!settings["evmVersion"].isString())
@@ -1062,6 +1079,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.modelCheckerSettings.timeout = modelCheckerSettings["timeout"].asUInt();
 	}
 
+	if (modelCheckerSettings.isMember("timeBudget"))
+	{
+		if (!modelCheckerSettings["timeBudget"].isUInt())
+			return formatFatalError("JSONError", "settings.modelChecker.timeBudget must be an unsigned integer.");
+		ret.modelCheckerSettings.timeBudget = modelCheckerSettings["timeBudget"].asUInt();
+	}
+
 	return { std::move(ret) };
 }
 
@@ -1074,6 +1098,8 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
+	compilerStack.setParallelism(_inputsAndSettings.parallelism);
+	compilerStack.enableProfiling(_inputsAndSettings.profile);
 	compilerStack.setEVMVersion(_inputsAndSettings.evmVersion);
 	compilerStack.setParserErrorRecovery(_inputsAndSettings.parserErrorRecovery);
 	compilerStack.setRemappings(move(_inputsAndSettings.remappings));
@@ -1085,6 +1111,10 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	compilerStack.useMetadataLiteralSources(_inputsAndSettings.metadataLiteralSources);
 	compilerStack.setMetadataHash(_inputsAndSettings.metadataHash);
 	compilerStack.setRequestedContractNames(requestedContractNames(_inputsAndSettings.outputSelection));
+	// Compilations of slightly changed inputs miss the output cache, but can still reuse
+	// the results of the SMT queries that did not change.
+	if (m_cacheDirectory)
+		_inputsAndSettings.modelCheckerSettings.cacheDirectory = *m_cacheDirectory / "smt";
 	compilerStack.setModelCheckerSettings(_inputsAndSettings.modelCheckerSettings);
 
 	compilerStack.enableEvmBytecodeGeneration(isEvmBytecodeRequested(_inputsAndSettings.outputSelection));
@@ -1357,6 +1387,9 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	if (!contractsOutput.empty())
 		output["contracts"] = contractsOutput;
 
+	if (_inputsAndSettings.profile)
+		output["profile"] = compilerStack.profile();
+
 	return output;
 }
 
@@ -1407,6 +1440,9 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 		return output;
 	}
 
+	unique_ptr<util::Profiler> profiler = _inputsAndSettings.profile ? make_unique<util::Profiler>() : nullptr;
+	util::Profiler::Activation profilerActivation(profiler.get());
+
 	AssemblyStack stack(
 		_inputsAndSettings.evmVersion,
 		AssemblyStack::Language::StrictAssembly,
@@ -1418,8 +1454,14 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 	string const& sourceName = _inputsAndSettings.sources.begin()->first;
 	string const& sourceContents = _inputsAndSettings.sources.begin()->second;
 
+	bool analysisSuccessful = false;
+	{
+		util::ProfilerScope profilerScope("phase", "parsing and analysis");
+		analysisSuccessful = stack.parseAndAnalyze(sourceName, sourceContents);
+	}
+
 	// Inconsistent state - stop here to receive error reports from users
-	if (!stack.parseAndAnalyze(sourceName, sourceContents) && stack.errors().empty())
+	if (!analysisSuccessful && stack.errors().empty())
 	{
 		output["errors"].append(formatError(
 			Error::Severity::Error,
@@ -1458,11 +1500,17 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 	if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, contractName, "ir", wildcardMatchesExperimental))
 		output["contracts"][sourceName][contractName]["ir"] = stack.print();
 
-	stack.optimize();
+	{
+		util::ProfilerScope profilerScope("phase", "optimization");
+		stack.optimize();
+	}
 
 	MachineAssemblyObject object;
 	MachineAssemblyObject runtimeObject;
-	tie(object, runtimeObject) = stack.assembleWithDeployed();
+	{
+		util::ProfilerScope profilerScope("phase", "assembly");
+		tie(object, runtimeObject) = stack.assembleWithDeployed();
+	}
 
 	if (object.bytecode)
 		object.bytecode->link(_inputsAndSettings.libraries);
@@ -1501,26 +1549,23 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 	if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, contractName, "evm.assembly", wildcardMatchesExperimental))
 		output["contracts"][sourceName][contractName]["evm"]["assembly"] = object.assembly;
 
+	if (profiler)
+		output["profile"] = profiler->toJson();
+
 	return output;
 }
 
 
 Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 {
-	YulStringRepository::reset();
+	YulStringRepository::Session yulStringSession;
 
 	try
 	{
-		auto parsed = parseInput(_input);
-		if (std::holds_alternative<Json::Value>(parsed))
-			return std::get<Json::Value>(std::move(parsed));
-		InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
-		if (settings.language == "Solidity")
-			return compileSolidity(std::move(settings));
-		else if (settings.language == "Yul")
-			return compileYul(std::move(settings));
+		if (m_cacheDirectory)
+			return compileCached(_input);
 		else
-			return formatFatalError("JSONError", "Only \"Solidity\" or \"Yul\" is supported as a language.");
+			return compileInput(_input);
 	}
 	catch (Json::LogicError const& _exception)
 	{
@@ -1540,6 +1585,56 @@ Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 	}
 }
 
+Json::Value StandardCompiler::compileInput(Json::Value const& _input)
+{
+	auto parsed = parseInput(_input);
+	if (std::holds_alternative<Json::Value>(parsed))
+		return std::get<Json::Value>(std::move(parsed));
+	InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
+	if (settings.language == "Solidity")
+		return compileSolidity(std::move(settings));
+	else if (settings.language == "Yul")
+		return compileYul(std::move(settings));
+	else
+		return formatFatalError("JSONError", "Only \"Solidity\" or \"Yul\" is supported as a language.");
+}
+
+Json::Value StandardCompiler::compileCached(Json::Value const& _input)
+{
+	solAssert(m_cacheDirectory.has_value(), "");
+	// A stored profile would not describe the current run.
+	if (_input.isObject() && _input["settings"].isObject() && _input["settings"]["profile"] == true)
+		return compileInput(_input);
+
+	CompilationCache cache(*m_cacheDirectory);
+	if (optional<Json::Value> output = cache.lookup(_input, m_readFile))
+	{
+		++m_cacheHits;
+		return *output;
+	}
+
+	vector<CompilationCache::Query> queries;
+	ReadCallback::Callback readFile = m_readFile;
+	m_readFile = CompilationCache::recordingCallback(readFile, queries);
+	ScopeGuard restoreReadFile([&]() { m_readFile = readFile; });
+
+	Json::Value output = compileInput(_input);
+
+	// Only files can be validated cheaply when looking up the entry, so the outputs of
+	// compilations that made other queries (i.e. to an SMT solver) are not stored.
+	// Failed compilations are not stored either, since they might be caused by transient issues.
+	bool cacheable = all_of(queries.begin(), queries.end(), [](CompilationCache::Query const& _query) {
+		return _query.kind == ReadCallback::kindString(ReadCallback::Kind::ReadFile);
+	});
+	for (Json::Value const& error: output["errors"])
+		if (error["severity"] == "error")
+			cacheable = false;
+	if (cacheable)
+		cache.store(_input, queries, output);
+
+	return output;
+}
+
 string StandardCompiler::compile(string const& _input) noexcept
 {
 	Json::Value input;
@@ -28,6 +28,8 @@
 
 #include <liblangutil/DebugInfoSelection.h>
 
+#include <boost/filesystem.hpp>
+
 #include <optional>
 #include <utility>
 #include <variant>
@@ -56,6 +58,14 @@ public:
 	{
 	}
 
+	/// Enables caching of the outputs of compilations in the given directory.
+	/// A cached output is returned if the input and all files loaded through the read callback
+	/// are unchanged, without compiling anything.
+	/// The results of the queries of the model checker are cached in a subdirectory.
+	void setCacheDirectory(boost::filesystem::path _directory) { m_cacheDirectory = std::move(_directory); }
+	/// @returns the number of compilations whose output was taken from the cache.
+	size_t cacheHits() const { return m_cacheHits; }
+
 	/// Sets all input parameters according to @a _input which conforms to the standardized input
 	/// format, performs compilation and returns a standardized output.
 	Json::Value compile(Json::Value const& _input) noexcept;
@@ -87,18 +97,28 @@ private:
 		Json::Value outputSelection;
 		ModelCheckerSettings modelCheckerSettings = ModelCheckerSettings{};
 		bool viaIR = false;
+		size_t parallelism = 1;
+		bool profile = false;
 	};
 
 	/// Parses the input json (and potentially invokes the read callback) and either returns
 	/// it in condensed form or an error as a json object.
 	std::variant<InputsAndSettings, Json::Value> parseInput(Json::Value const& _input);
 
+	/// Performs the compilation of @a _input without consulting the cache.
+	Json::Value compileInput(Json::Value const& _input);
+	/// Returns the cached output for @a _input if available, otherwise compiles it and stores
+	/// the output in the cache.
+	Json::Value compileCached(Json::Value const& _input);
 	Json::Value compileSolidity(InputsAndSettings _inputsAndSettings);
 	Json::Value compileYul(InputsAndSettings _inputsAndSettings);
 
 	ReadCallback::Callback m_readFile;
 
 	util::JsonFormat m_jsonPrintingFormat;
+
+	std::optional<boost::filesystem::path> m_cacheDirectory;
+	size_t m_cacheHits = 0;
 };
 
 }
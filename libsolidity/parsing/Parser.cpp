@@ -72,7 +72,7 @@ public:
 		solAssert(m_location.sourceName, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		return m_parser.allocateNode<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
@@ -88,6 +88,7 @@ ASTPointer<SourceUnit> Parser::parse(CharStream& _charStream)
 	try
 	{
 		m_recursionDepth = 0;
+		m_arena = make_shared<ASTArena>();
 		m_scanner = make_shared<Scanner>(_charStream);
 		ASTNodeFactory nodeFactory(*this);
 
@@ -1327,7 +1328,7 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 		BOOST_THROW_EXCEPTION(FatalError());
 
 	location.end = nativeLocationOf(*block).end;
-	return make_shared<InlineAssembly>(nextID(), location, _docString, dialect, block);
+	return allocateNode<InlineAssembly>(nextID(), location, _docString, dialect, block);
 }
 
 ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString> const& _docString)
@@ -2084,24 +2085,26 @@ optional<string> Parser::findLicenseString(std::vector<ASTPointer<ASTNode>> cons
 
 	// Search inside all parts of the source not covered by parsed nodes.
 	// This will leave e.g. "global comments".
-	using iter = std::string::const_iterator;
+	using iter = char const*;
 	vector<pair<iter, iter>> sequencesToSearch;
-	string const& source = m_scanner->charStream().source();
-	sequencesToSearch.emplace_back(source.begin(), source.end());
+	string_view source = m_scanner->charStream().source();
+	iter const sourceBegin = source.data();
+	iter const sourceEnd = source.data() + source.size();
+	sequencesToSearch.emplace_back(sourceBegin, sourceEnd);
 	for (ASTPointer<ASTNode> const& node: _nodes)
 		if (node->location().hasText())
 		{
-			sequencesToSearch.back().second = source.begin() + node->location().start;
-			sequencesToSearch.emplace_back(source.begin() + node->location().end, source.end());
+			sequencesToSearch.back().second = sourceBegin + node->location().start;
+			sequencesToSearch.emplace_back(sourceBegin + node->location().end, sourceEnd);
 		}
 
 	vector<string> licenseNames;
 	for (auto const& [start, end]: sequencesToSearch)
 	{
-		auto declarationsBegin = std::sregex_iterator(start, end, licenseDeclarationRegex);
-		auto declarationsEnd = std::sregex_iterator();
+		auto declarationsBegin = std::cregex_iterator(start, end, licenseDeclarationRegex);
+		auto declarationsEnd = std::cregex_iterator();
 
-		for (std::sregex_iterator declIt = declarationsBegin; declIt != declarationsEnd; ++declIt)
+		for (std::cregex_iterator declIt = declarationsBegin; declIt != declarationsEnd; ++declIt)
 			if (!declIt->empty())
 			{
 				string license = boost::trim_copy(string((*declIt)[1]));
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTArena.h>
 #include <liblangutil/ParserBase.h>
 #include <liblangutil/EVMVersion.h>
 
@@ -49,6 +50,12 @@ public:
 
 	ASTPointer<SourceUnit> parse(langutil::CharStream& _charStream);
 
+	/// Continues the numbering of AST nodes after @a _nodeID, so that the IDs are unique
+	/// together with the ones of nodes created by an earlier parser.
+	void continueNodeIDsAfter(int64_t _nodeID) { m_currentNodeID = _nodeID; }
+	/// @returns the ID of the last AST node created by this parser.
+	int64_t lastNodeID() const { return m_currentNodeID; }
+
 private:
 	class ASTNodeFactory;
 
@@ -189,6 +196,21 @@ private:
 	/// Returns the next AST node ID
 	int64_t nextID() { return ++m_currentNodeID; }
 
+	/// Creates an AST node whose storage is taken from the arena of the source unit being parsed.
+	/// The source unit itself is allocated separately and takes over the arena.
+	template <class NodeType, typename... Args>
+	ASTPointer<NodeType> allocateNode(Args&&... _args)
+	{
+		if constexpr (std::is_same_v<NodeType, SourceUnit>)
+		{
+			auto sourceUnit = std::make_shared<SourceUnit>(std::forward<Args>(_args)...);
+			sourceUnit->setArena(std::move(m_arena));
+			return sourceUnit;
+		}
+		else
+			return std::allocate_shared<NodeType>(ASTArenaAllocator<NodeType>(m_arena.get()), std::forward<Args>(_args)...);
+	}
+
 	std::pair<LookAheadInfo, IndexAccessedPath> tryParseIndexAccessedPath();
 	/// Performs limited look-ahead to distinguish between variable declaration and expression statement.
 	/// For source code of the form "a[][8]" ("IndexAccessStructure"), this is not possible to
@@ -217,6 +239,9 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	/// Counter for the next AST node ID
 	int64_t m_currentNodeID = 0;
+	/// Storage for the nodes of the source unit currently being parsed, until it is handed over
+	/// to the source unit.
+	std::shared_ptr<ASTArena> m_arena;
 };
 
 }
@@ -22,8 +22,10 @@
 
 #include <libsolutil/Keccak256.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <numeric>
 
 using namespace std;
 
@@ -169,6 +171,121 @@ inline void hash(
 	memset(a, 0, 200);
 }
 
+/******** Hashing several inputs at once. ********/
+
+// The multi-lane permutation relies on the vector extensions of GCC and Clang. With other
+// compilers, the inputs of a batch are hashed one after the other.
+#if defined(__GNUC__)
+#define KECCAK_LANES
+
+/// Number of inputs hashed together. The states are interleaved such that the same word of
+/// all lanes is contiguous, so every step of the permutation maps to vector instructions
+/// (four words fill an AVX2 register).
+size_t constexpr c_lanes = 4;
+/// The rate of Keccak-256 in bytes.
+size_t constexpr c_rate = 200 - (256 / 4);
+
+/// The same word of the states of all lanes.
+using Lanes = uint64_t __attribute__((vector_size(8 * c_lanes)));
+using LaneState = Lanes[25];
+
+// Let the compiler generate versions of the permutation for several instruction sets and pick
+// the best one supported by the CPU at load time. The default version is plain scalar code.
+#if defined(__x86_64__) && defined(__linux__) && (defined(__clang__) ? __clang_major__ >= 14 : defined(__GNUC__))
+#define KECCAK_MULTI_VERSION __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define KECCAK_MULTI_VERSION
+#endif
+
+// The loops over the words have to be unrolled, such that the indices and rotation offsets
+// are constants and the state can be kept in registers.
+#define KECCAK_UNROLL _Pragma("GCC unroll 25")
+
+/// Keccak-f[1600] applied to each of the lanes.
+KECCAK_MULTI_VERSION
+void keccakfLanes(LaneState& _state)
+{
+	for (size_t round = 0; round < 24; ++round)
+	{
+		Lanes b[5];
+		// Theta
+		KECCAK_UNROLL
+		for (size_t x = 0; x < 5; ++x)
+			b[x] = _state[x] ^ _state[x + 5] ^ _state[x + 10] ^ _state[x + 15] ^ _state[x + 20];
+		KECCAK_UNROLL
+		for (size_t x = 0; x < 5; ++x)
+		{
+			Lanes d = b[(x + 4) % 5] ^ rol(b[(x + 1) % 5], 1);
+			KECCAK_UNROLL
+			for (size_t y = 0; y < 25; y += 5)
+				_state[y + x] ^= d;
+		}
+		// Rho and pi
+		Lanes t = _state[1];
+		KECCAK_UNROLL
+		for (size_t i = 0; i < 24; ++i)
+		{
+			Lanes next = _state[pi[i]];
+			_state[pi[i]] = rol(t, rho[i]);
+			t = next;
+		}
+		// Chi
+		KECCAK_UNROLL
+		for (size_t y = 0; y < 25; y += 5)
+		{
+			KECCAK_UNROLL
+			for (size_t x = 0; x < 5; ++x)
+				b[x] = _state[y + x];
+			KECCAK_UNROLL
+			for (size_t x = 0; x < 5; ++x)
+				_state[y + x] = b[x] ^ ((~b[(x + 1) % 5]) & b[(x + 2) % 5]);
+		}
+		// Iota
+		for (size_t lane = 0; lane < c_lanes; ++lane)
+			_state[0][lane] ^= RC[round];
+	}
+}
+
+/// @returns the number of permutations needed to absorb an input of the given size including padding.
+size_t blockCount(size_t _size)
+{
+	return _size / c_rate + 1;
+}
+
+/// Xors block @a _block of @a _input, padded if it is the last one, into the given lane.
+void absorbBlock(LaneState& _state, size_t _lane, bytesConstRef _input, size_t _block)
+{
+	uint8_t padded[c_rate];
+	uint8_t const* data = _input.data() + _block * c_rate;
+	if (_block + 1 == blockCount(_input.size()))
+	{
+		size_t remaining = _input.size() - _block * c_rate;
+		memset(padded, 0, c_rate);
+		if (remaining > 0)
+			memcpy(padded, data, remaining);
+		padded[remaining] ^= 0x01;
+		padded[c_rate - 1] ^= 0x80;
+		data = padded;
+	}
+	for (size_t word = 0; word < c_rate / 8; ++word)
+	{
+		uint64_t value = 0;
+		for (size_t i = 0; i < 8; ++i)
+			value |= static_cast<uint64_t>(data[word * 8 + i]) << (8 * i);
+		_state[word][_lane] ^= value;
+	}
+}
+
+/// Stores the first 32 bytes of the given lane in @a _output.
+void squeeze(LaneState const& _state, size_t _lane, h256& _output)
+{
+	for (size_t word = 0; word < h256::size / 8; ++word)
+		for (size_t i = 0; i < 8; ++i)
+			_output.data()[word * 8 + i] = static_cast<uint8_t>(_state[word][_lane] >> (8 * i));
+}
+
+#endif
+
 }
 
 h256 keccak256(bytesConstRef _input)
@@ -182,4 +299,39 @@ h256 keccak256(bytesConstRef _input)
 	return output;
 }
 
+vector<h256> keccak256Batch(vector<bytesConstRef> const& _inputs)
+{
+	vector<h256> outputs(_inputs.size());
+	size_t next = 0;
+	vector<size_t> order(_inputs.size());
+	iota(order.begin(), order.end(), 0);
+#ifdef KECCAK_LANES
+	// Inputs with the same number of blocks are hashed together, so that no lane is idle
+	// while the others still absorb.
+	stable_sort(order.begin(), order.end(), [&](size_t _a, size_t _b) {
+		return blockCount(_inputs[_a].size()) < blockCount(_inputs[_b].size());
+	});
+
+	for (; order.size() - next >= c_lanes; next += c_lanes)
+	{
+		LaneState state = {};
+		size_t blocks = blockCount(_inputs[order[next + c_lanes - 1]].size());
+		for (size_t block = 0; block < blocks; ++block)
+		{
+			for (size_t lane = 0; lane < c_lanes; ++lane)
+				if (block < blockCount(_inputs[order[next + lane]].size()))
+					absorbBlock(state, lane, _inputs[order[next + lane]], block);
+			keccakfLanes(state);
+			for (size_t lane = 0; lane < c_lanes; ++lane)
+				if (block + 1 == blockCount(_inputs[order[next + lane]].size()))
+					squeeze(state, lane, outputs[order[next + lane]]);
+		}
+	}
+#endif
+	// Hash the inputs that are left over one by one.
+	for (; next < order.size(); ++next)
+		outputs[order[next]] = keccak256(_inputs[order[next]]);
+	return outputs;
+}
+
 }
@@ -0,0 +1,197 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Parallel.h>
+#include <libsolutil/Profiler.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+
+namespace
+{
+
+/// The indices of one parallelFor call, shared by the calling thread and the pool threads helping it.
+struct Job
+{
+	Job(size_t _count, function<void(size_t)> const& _task):
+		count(_count), task(_task), profilerContext(Profiler::threadContext())
+	{}
+
+	/// Runs tasks until all indices have been handed out or a task failed.
+	void work()
+	{
+		// Phases recorded by the tasks belong to the same profile on all threads.
+		Profiler::Activation profilerActivation(profilerContext);
+		while (!failed)
+		{
+			size_t index = nextIndex++;
+			if (index >= count)
+				return;
+			try
+			{
+				task(index);
+			}
+			catch (...)
+			{
+				lock_guard<mutex> lock(jobMutex);
+				if (!firstFailure || index < firstFailure->first)
+					firstFailure = make_pair(index, current_exception());
+				failed = true;
+			}
+		}
+	}
+
+	size_t const count;
+	/// Only valid until the job is closed.
+	function<void(size_t)> const& task;
+	Profiler::ThreadContext const profilerContext;
+	atomic<size_t> nextIndex{0};
+	atomic<bool> failed{false};
+
+	mutex jobMutex;
+	condition_variable helpersFinished;
+	/// Set by the calling thread once it is done. Helpers that have not started by then do not start at all.
+	bool closed = false;
+	size_t activeHelpers = 0;
+	optional<pair<size_t, exception_ptr>> firstFailure;
+};
+
+/// Threads that are kept alive between parallelFor calls, so that calls with small tasks
+/// do not pay for starting threads each time.
+class ThreadPool
+{
+public:
+	static ThreadPool& instance()
+	{
+		static ThreadPool pool;
+		return pool;
+	}
+
+	~ThreadPool()
+	{
+		{
+			lock_guard<mutex> lock(m_mutex);
+			m_stopping = true;
+		}
+		m_wakeUp.notify_all();
+		for (thread& poolThread: m_threads)
+			poolThread.join();
+	}
+
+	/// Lets up to @a _helpers pool threads work on @a _job, starting more threads if the pool
+	/// has fewer than that. Threads that are busy with other jobs pick the job up later, if at all.
+	void help(shared_ptr<Job> const& _job, size_t _helpers)
+	{
+		{
+			lock_guard<mutex> lock(m_mutex);
+			for (size_t i = 0; i < _helpers; ++i)
+				m_queue.push_back(_job);
+			while (m_threads.size() < _helpers)
+				try
+				{
+					m_threads.emplace_back([this]() { run(); });
+				}
+				catch (system_error const&)
+				{
+					// Could not spawn more threads, continue with the ones we have.
+					break;
+				}
+		}
+		m_wakeUp.notify_all();
+	}
+
+private:
+	ThreadPool() = default;
+
+	void run()
+	{
+		while (true)
+		{
+			shared_ptr<Job> job;
+			{
+				unique_lock<mutex> lock(m_mutex);
+				m_wakeUp.wait(lock, [&]() { return m_stopping || !m_queue.empty(); });
+				if (m_stopping)
+					return;
+				job = move(m_queue.front());
+				m_queue.pop_front();
+			}
+
+			{
+				lock_guard<mutex> lock(job->jobMutex);
+				if (job->closed)
+					continue;
+				++job->activeHelpers;
+			}
+			job->work();
+			{
+				lock_guard<mutex> lock(job->jobMutex);
+				--job->activeHelpers;
+			}
+			job->helpersFinished.notify_all();
+		}
+	}
+
+	mutex m_mutex;
+	condition_variable m_wakeUp;
+	/// One entry for every helper requested by a job.
+	deque<shared_ptr<Job>> m_queue;
+	vector<thread> m_threads;
+	bool m_stopping = false;
+};
+
+}
+
+size_t util::defaultParallelism()
+{
+	return max<size_t>(thread::hardware_concurrency(), 1);
+}
+
+void util::parallelFor(size_t _count, size_t _maxThreads, function<void(size_t)> const& _task)
+{
+	if (_maxThreads <= 1 || _count <= 1)
+	{
+		for (size_t index = 0; index < _count; ++index)
+			_task(index);
+		return;
+	}
+
+	auto job = make_shared<Job>(_count, _task);
+	ThreadPool::instance().help(job, min(_maxThreads, _count) - 1);
+	job->work();
+
+	unique_lock<mutex> lock(job->jobMutex);
+	job->closed = true;
+	job->helpersFinished.wait(lock, [&]() { return job->activeHelpers == 0; });
+	if (job->firstFailure)
+		rethrow_exception(job->firstFailure->second);
+}
@@ -0,0 +1,47 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Helpers for running independent pieces of work on multiple threads.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace solidity::util
+{
+
+/// @returns the number of threads used if no explicit number of jobs is requested,
+/// i.e. the number of hardware threads or one if that cannot be determined.
+size_t defaultParallelism();
+
+/// Calls @a _task for every index in [0, @a _count) using at most @a _maxThreads threads,
+/// including the calling one. Indices are handed out in increasing order, but the calls
+/// may overlap, so @a _task must only modify state that belongs to its index.
+/// If @a _maxThreads is at most one, the calls are performed in order on the calling thread.
+/// If calls throw, no further indices are handed out and, once all running calls have
+/// finished, the exception of the smallest failing index is rethrown. This is the same
+/// exception a sequential run would have thrown.
+/// The profiler active on the calling thread is also active while the tasks run.
+/// The threads other than the calling one come from a pool that is kept alive between calls.
+/// If they are busy with other calls, for example with an enclosing parallelFor, the calling
+/// thread performs more of the calls itself.
+void parallelFor(size_t _count, size_t _maxThreads, std::function<void(size_t)> const& _task);
+
+}
@@ -0,0 +1,201 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Profiler.h>
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+
+namespace
+{
+
+thread_local Profiler::ThreadContext t_context;
+thread_local uint64_t t_allocations = 0;
+
+/// Sums of the events that belong to the same phase.
+struct PhaseTotals
+{
+	string_view category;
+	string_view name;
+	uint64_t count = 0;
+	uint64_t duration = 0;
+	uint64_t allocations = 0;
+};
+
+/// Adds @a _event to the totals of its phase, keeping the phases in the order of their first occurrence.
+void addToTotals(vector<PhaseTotals>& _totals, Profiler::Event const& _event)
+{
+	auto it = find_if(_totals.begin(), _totals.end(), [&](PhaseTotals const& _phase) {
+		return _phase.category == _event.category && _phase.name == _event.name;
+	});
+	if (it == _totals.end())
+		it = _totals.insert(_totals.end(), PhaseTotals{_event.category, _event.name});
+	it->count++;
+	it->duration += _event.duration;
+	it->allocations += _event.allocations;
+}
+
+Json::Value totalsToJson(vector<PhaseTotals> const& _totals)
+{
+	Json::Value result{Json::arrayValue};
+	for (PhaseTotals const& phase: _totals)
+	{
+		Json::Value entry{Json::objectValue};
+		entry["category"] = string(phase.category);
+		entry["name"] = string(phase.name);
+		entry["count"] = Json::UInt64(phase.count);
+		entry["wallTime"] = Json::UInt64(phase.duration);
+		entry["allocations"] = Json::UInt64(phase.allocations);
+		result.append(move(entry));
+	}
+	return result;
+}
+
+}
+
+Profiler::Activation::Activation(ThreadContext _context):
+	m_previous(exchange(t_context, move(_context)))
+{
+}
+
+Profiler::Activation::~Activation()
+{
+	t_context = move(m_previous);
+}
+
+Profiler::ThreadContext const& Profiler::threadContext()
+{
+	return t_context;
+}
+
+vector<Profiler::Event> Profiler::events() const
+{
+	vector<Event> result;
+	{
+		lock_guard<mutex> lock(m_mutex);
+		result = m_events;
+	}
+	// Events are recorded when they end, so nested events come before their parents.
+	stable_sort(result.begin(), result.end(), [](Event const& _a, Event const& _b) {
+		return make_tuple(_a.start, _b.duration) < make_tuple(_b.start, _a.duration);
+	});
+	return result;
+}
+
+Json::Value Profiler::toJson() const
+{
+	vector<Event> allEvents = events();
+
+	Json::Value traceEvents{Json::arrayValue};
+	vector<PhaseTotals> phases;
+	map<string, vector<PhaseTotals>> contracts;
+	for (Event const& event: allEvents)
+	{
+		Json::Value traceEvent{Json::objectValue};
+		traceEvent["name"] = string(event.name);
+		traceEvent["cat"] = string(event.category);
+		traceEvent["ph"] = "X";
+		traceEvent["ts"] = Json::UInt64(event.start);
+		traceEvent["dur"] = Json::UInt64(event.duration);
+		traceEvent["pid"] = 0;
+		traceEvent["tid"] = Json::UInt64(event.thread);
+		traceEvent["args"]["allocations"] = Json::UInt64(event.allocations);
+		if (!event.contract.empty())
+			traceEvent["args"]["contract"] = event.contract;
+		traceEvents.append(move(traceEvent));
+
+		addToTotals(phases, event);
+		if (!event.contract.empty())
+			addToTotals(contracts[event.contract], event);
+	}
+
+	Json::Value result{Json::objectValue};
+	result["displayTimeUnit"] = "ms";
+	result["traceEvents"] = move(traceEvents);
+	result["phases"] = totalsToJson(phases);
+	result["contracts"] = Json::objectValue;
+	for (auto const& [contract, totals]: contracts)
+		result["contracts"][contract] = totalsToJson(totals);
+	return result;
+}
+
+uint64_t Profiler::microsecondsSinceStart() const
+{
+	return static_cast<uint64_t>(
+		chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - m_start).count()
+	);
+}
+
+void Profiler::record(Event _event)
+{
+	lock_guard<mutex> lock(m_mutex);
+	_event.thread = m_threadIndices.emplace(this_thread::get_id(), m_threadIndices.size()).first->second;
+	m_events.emplace_back(move(_event));
+}
+
+ProfilerScope::ProfilerScope(string_view _category, string_view _name, string_view _contract):
+	m_profiler(t_context.profiler)
+{
+	if (!m_profiler)
+		return;
+
+	if (!_contract.empty())
+		m_previousContract = exchange(t_context.contract, string(_contract));
+	else
+		m_previousContract = t_context.contract;
+	m_event.category = _category;
+	m_event.name = _name;
+	m_event.contract = t_context.contract;
+	m_event.allocations = t_allocations;
+	m_event.start = m_profiler->microsecondsSinceStart();
+}
+
+ProfilerScope::~ProfilerScope()
+{
+	if (!m_profiler)
+		return;
+
+	m_event.duration = m_profiler->microsecondsSinceStart() - m_event.start;
+	m_event.allocations = t_allocations - m_event.allocations;
+	t_context.contract = move(m_previousContract);
+	try
+	{
+		m_profiler->record(move(m_event));
+	}
+	catch (...)
+	{
+		// Failing to record a phase must not affect the compilation.
+	}
+}
+
+void util::countAllocation() noexcept
+{
+	++t_allocations;
+}
+
+uint64_t util::allocationCount() noexcept
+{
+	return t_allocations;
+}
@@ -0,0 +1,136 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Recording of the time spent in the phases of a compilation.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Json
+{
+class Value;
+}
+
+namespace solidity::util
+{
+
+/// Collects the wall time and the number of heap allocations of the phases of a compilation.
+/// Phases are recorded through ProfilerScope on threads on which the profiler is active.
+class Profiler
+{
+public:
+	struct Event
+	{
+		/// Kind of the phase, e.g. "analysis" or "yulOptimiserStep".
+		/// Refers to static storage, like the name.
+		std::string_view category;
+		/// Refers to static storage, so recording a phase does not copy its name.
+		std::string_view name;
+		/// Fully qualified name of the contract the phase belongs to, if any.
+		std::string contract;
+		/// Start time in microseconds since the creation of the profiler.
+		uint64_t start = 0;
+		/// Wall time in microseconds, including nested phases.
+		uint64_t duration = 0;
+		/// Number of heap allocations made on the thread of the phase, including nested phases.
+		uint64_t allocations = 0;
+		/// Index of the thread the phase ran on, in the order threads first recorded a phase.
+		size_t thread = 0;
+	};
+
+	/// State that determines where the phases recorded on a thread go.
+	struct ThreadContext
+	{
+		Profiler* profiler = nullptr;
+		std::string contract;
+	};
+
+	/// Makes a profiler active on the current thread for the lifetime of the object.
+	/// Passing a null profiler deactivates profiling.
+	class Activation
+	{
+	public:
+		explicit Activation(ThreadContext _context);
+		explicit Activation(Profiler* _profiler): Activation(ThreadContext{_profiler, {}}) {}
+		~Activation();
+		Activation(Activation const&) = delete;
+		Activation& operator=(Activation const&) = delete;
+	private:
+		ThreadContext m_previous;
+	};
+
+	Profiler(): m_start(std::chrono::steady_clock::now()) {}
+
+	/// @returns the profiler and contract active on the current thread.
+	static ThreadContext const& threadContext();
+
+	/// @returns all recorded events ordered by start time.
+	std::vector<Event> events() const;
+
+	/// @returns the events and their sums per phase and per contract. The object can be
+	/// loaded as a trace in Chrome's about:tracing or Perfetto, which ignore the sums.
+	Json::Value toJson() const;
+
+private:
+	friend class ProfilerScope;
+
+	uint64_t microsecondsSinceStart() const;
+	void record(Event _event);
+
+	std::chrono::steady_clock::time_point const m_start;
+	mutable std::mutex m_mutex;
+	std::vector<Event> m_events;
+	std::map<std::thread::id, size_t> m_threadIndices;
+};
+
+/// Records the time and allocations between its construction and its destruction as a phase
+/// of the profiler active on the current thread. Costs only a check if no profiler is active.
+/// If @a _contract is not empty, phases nested in this one are attributed to that contract.
+/// @a _category and @a _name have to refer to static storage, e.g. string literals.
+class ProfilerScope
+{
+public:
+	ProfilerScope(std::string_view _category, std::string_view _name, std::string_view _contract = {});
+	~ProfilerScope();
+	ProfilerScope(ProfilerScope const&) = delete;
+	ProfilerScope& operator=(ProfilerScope const&) = delete;
+
+private:
+	Profiler* m_profiler = nullptr;
+	Profiler::Event m_event;
+	std::string m_previousContract;
+};
+
+/// Increments the number of heap allocations of the current thread.
+/// Executables that want allocation counts in their profiles call this from a replacement
+/// of the global operator new. Otherwise all recorded allocation counts are zero.
+void countAllocation() noexcept;
+
+/// @returns the number of allocations counted on the current thread so far.
+uint64_t allocationCount() noexcept;
+
+}
@@ -0,0 +1,92 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/SharedText.h>
+
+#include <libsolutil/Assertions.h>
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+
+#include <boost/filesystem/operations.hpp>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+
+namespace
+{
+
+/// Files smaller than this are read instead of mapped, since a mapping costs a few system calls
+/// and at least one page.
+size_t constexpr c_minimumMappedSize = 64 * 1024;
+
+}
+
+SharedText::~SharedText()
+{
+#if !defined(_WIN32)
+	if (m_mapping)
+		munmap(m_mapping, m_mappingSize);
+#endif
+}
+
+SharedTextPointer SharedText::fromString(string _text)
+{
+	shared_ptr<SharedText> text{new SharedText()};
+	text->m_string = move(_text);
+	text->m_view = text->m_string;
+	return text;
+}
+
+SharedTextPointer SharedText::fromFile(boost::filesystem::path const& _file)
+{
+#if !defined(_WIN32)
+	assertThrow(boost::filesystem::exists(_file), FileNotFound, _file.string());
+	assertThrow(boost::filesystem::is_regular_file(_file), NotAFile, _file.string());
+
+	int descriptor = open(_file.string().c_str(), O_RDONLY | O_CLOEXEC);
+	assertThrow(descriptor >= 0, FileNotFound, _file.string());
+	struct stat status;
+	void* mapping = MAP_FAILED;
+	size_t size = 0;
+	if (fstat(descriptor, &status) == 0 && static_cast<size_t>(status.st_size) >= c_minimumMappedSize)
+	{
+		size = static_cast<size_t>(status.st_size);
+		mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+	}
+	close(descriptor);
+
+	if (mapping != MAP_FAILED)
+	{
+		shared_ptr<SharedText> text{new SharedText()};
+		text->m_mapping = mapping;
+		text->m_mappingSize = size;
+		text->m_view = string_view(static_cast<char const*>(mapping), size);
+		return text;
+	}
+#endif
+	// Small files, platforms without mmap and files that cannot be mapped.
+	return fromString(readFileAsString(_file));
+}
@@ -0,0 +1,73 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Immutable text that is shared instead of copied, e.g. the contents of source files.
+ */
+
+#pragma once
+
+#include <boost/filesystem/path.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace solidity::util
+{
+
+class SharedText;
+using SharedTextPointer = std::shared_ptr<SharedText const>;
+
+/**
+ * Immutable text that either owns a string or a read-only memory mapping of a file.
+ * It is only handled through SharedTextPointer, so that all users view the same memory.
+ */
+class SharedText
+{
+public:
+	SharedText(SharedText const&) = delete;
+	SharedText& operator=(SharedText const&) = delete;
+	~SharedText();
+
+	/// @returns a shared text that takes over @a _text.
+	static SharedTextPointer fromString(std::string _text);
+
+	/// @returns the contents of the given file. Large files are mapped into memory if the
+	/// platform supports it, small files are read.
+	/// The file must not be modified while the returned text is in use: if another process
+	/// truncates a mapped file, accessing the text terminates the process with SIGBUS instead
+	/// of reporting an error, and other changes may or may not become visible in the text.
+	/// Callers that cannot rule this out, e.g. because they keep the text while the user edits
+	/// the file, should use fromString(readFileAsString(_file)) instead.
+	/// Throws FileNotFound and NotAFile in the same cases as readFileAsString.
+	static SharedTextPointer fromFile(boost::filesystem::path const& _file);
+
+	std::string_view view() const noexcept { return m_view; }
+	size_t size() const noexcept { return m_view.size(); }
+
+private:
+	SharedText() = default;
+
+	std::string m_string;
+	void* m_mapping = nullptr;
+	size_t m_mappingSize = 0;
+	std::string_view m_view;
+};
+
+}
@@ -68,11 +68,32 @@ h256 bmtHash(bytesConstRef _data)
 	if (_data.size() <= 64)
 		return keccak256(_data);
 
-	size_t midPoint = _data.size() / 2;
-	return keccak256(
-		bmtHash(_data.cropped(0, midPoint)).asBytes() +
-		bmtHash(_data.cropped(midPoint)).asBytes()
-	);
+	size_t const leafCount = _data.size() / 64;
+	if (_data.size() % 64 != 0 || (leafCount & (leafCount - 1)) != 0)
+	{
+		size_t midPoint = _data.size() / 2;
+		return keccak256(
+			bmtHash(_data.cropped(0, midPoint)).asBytes() +
+			bmtHash(_data.cropped(midPoint)).asBytes()
+		);
+	}
+
+	// The tree is complete, so all nodes of the same level can be hashed at once.
+	vector<bytesConstRef> nodes;
+	for (size_t i = 0; i < leafCount; ++i)
+		nodes.push_back(_data.cropped(i * 64, 64));
+	vector<h256> hashes = keccak256Batch(nodes);
+	while (hashes.size() > 1)
+	{
+		bytes level;
+		for (h256 const& hash: hashes)
+			level += hash.asBytes();
+		nodes.clear();
+		for (size_t i = 0; i < level.size(); i += 64)
+			nodes.push_back(bytesConstRef(&level).cropped(i, 64));
+		hashes = keccak256Batch(nodes);
+	}
+	return hashes.front();
 }
 
 h256 chunkHash(bytesConstRef const _data, bool _forceHigherLevel = false)
@@ -110,9 +131,9 @@ h256 solidity::util::bzzr0Hash(string const& _input)
 }
 
 
-h256 solidity::util::bzzr1Hash(bytes const& _input)
+h256 solidity::util::bzzr1Hash(bytesConstRef _input)
 {
 	if (_input.empty())
 		return h256{};
-	return chunkHash(&_input);
+	return chunkHash(_input);
 }
@@ -26,13 +26,217 @@
 
 #include <libsolutil/Assertions.h>
 
-#include <regex>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace std;
 using namespace solidity::util;
 
+namespace
+{
+
+bool isParameterCharacter(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+/// @returns the position after the parameter name starting at @a _pos in @a _text,
+/// which is @a _pos if there is none.
+size_t parameterEnd(string_view _text, size_t _pos)
+{
+	while (_pos < _text.size() && isParameterCharacter(_text[_pos]))
+		++_pos;
+	return _pos;
+}
+
+}
+
+struct Whiskers::Block
+{
+	struct Node;
+
+	/// The text of the block, used in error messages.
+	string_view source;
+	vector<Node> nodes;
+};
+
+struct Whiskers::Block::Node
+{
+	enum class Kind { Text, Value, List, Condition, NonEmptyCondition };
+
+	Kind kind = Kind::Text;
+	/// The text of a text node.
+	string_view text;
+	/// The name of the parameter, without the "+" of a non-empty condition.
+	string name;
+	/// The body of a list or the part of a condition used if it is true.
+	Block body;
+	/// The part of a condition used if it is false.
+	Block elseBody;
+};
+
+struct Whiskers::CompiledTemplate
+{
+	explicit CompiledTemplate(string _text);
+
+	/// @returns the compiled form of @a _text, parsing it only if it is not in the cache yet.
+	static shared_ptr<CompiledTemplate const> get(string _text);
+
+	/// Splits @a _source into text and tags. A tag that is not closed within @a _source
+	/// is kept as text, its contents are still parsed.
+	static Block parse(string_view _source);
+
+	string const text;
+	Block block;
+	/// The contents of all tags of the forms <name>, <?name>, <#name> and </name> in the text.
+	unordered_set<string_view> tags;
+};
+
+Whiskers::CompiledTemplate::CompiledTemplate(string _text):
+	text(move(_text))
+{
+	block = parse(text);
+	string_view source = text;
+	for (size_t pos = source.find('<'); pos != string_view::npos; pos = source.find('<', pos + 1))
+	{
+		size_t nameStart = pos + 1;
+		if (nameStart < source.size() && (source[nameStart] == '?' || source[nameStart] == '#' || source[nameStart] == '/'))
+			++nameStart;
+		size_t nameEnd = parameterEnd(source, nameStart);
+		if (nameEnd > nameStart && nameEnd < source.size() && source[nameEnd] == '>')
+			tags.insert(source.substr(pos + 1, nameEnd - pos - 1));
+	}
+}
+
+shared_ptr<Whiskers::CompiledTemplate const> Whiskers::CompiledTemplate::get(string _text)
+{
+	// Most templates are string literals, but some are assembled at runtime,
+	// so the cache is emptied from time to time.
+	static size_t const maxCachedTemplates = 4096;
+	static mutex cacheMutex;
+	static unordered_map<string, shared_ptr<CompiledTemplate const>> cache;
+
+	{
+		lock_guard<mutex> lock(cacheMutex);
+		if (auto it = cache.find(_text); it != cache.end())
+			return it->second;
+	}
+
+	auto compiled = make_shared<CompiledTemplate const>(_text);
+	lock_guard<mutex> lock(cacheMutex);
+	if (cache.size() >= maxCachedTemplates)
+		cache.clear();
+	cache.emplace(move(_text), compiled);
+	return compiled;
+}
+
+Whiskers::Block Whiskers::CompiledTemplate::parse(string_view _source)
+{
+	using Node = Block::Node;
+
+	Block result{_source, {}};
+	size_t textStart = 0;
+	for (size_t pos = _source.find('<'); pos != string_view::npos; pos = _source.find('<', pos + 1))
+	{
+		if (pos + 1 >= _source.size())
+			break;
+
+		Node node;
+		size_t end = string_view::npos;
+		char const kind = _source[pos + 1];
+		if (isParameterCharacter(kind))
+		{
+			// <name>
+			size_t nameEnd = parameterEnd(_source, pos + 1);
+			if (nameEnd < _source.size() && _source[nameEnd] == '>')
+			{
+				node.kind = Node::Kind::Value;
+				node.name = string(_source.substr(pos + 1, nameEnd - pos - 1));
+				end = nameEnd + 1;
+			}
+		}
+		else if (kind == '#')
+		{
+			// <#name>...</name>
+			size_t nameEnd = parameterEnd(_source, pos + 2);
+			if (nameEnd > pos + 2 && nameEnd < _source.size() && _source[nameEnd] == '>')
+			{
+				string_view name = _source.substr(pos + 2, nameEnd - pos - 2);
+				string closingTag = "</" + string(name) + ">";
+				size_t bodyStart = nameEnd + 1;
+				size_t closingPos = _source.find(closingTag, bodyStart);
+				if (closingPos != string_view::npos)
+				{
+					node.kind = Node::Kind::List;
+					node.name = string(name);
+					node.body = parse(_source.substr(bodyStart, closingPos - bodyStart));
+					end = closingPos + closingTag.size();
+				}
+			}
+		}
+		else if (kind == '?')
+		{
+			// <?name>...<!name>...</name> or <?+name>...<!+name>...</+name>
+			size_t nameStart = pos + 2;
+			bool nonEmptyCondition = nameStart < _source.size() && _source[nameStart] == '+';
+			size_t nameEnd = parameterEnd(_source, nonEmptyCondition ? nameStart + 1 : nameStart);
+			if (nameEnd > nameStart + (nonEmptyCondition ? 1 : 0) && nameEnd < _source.size() && _source[nameEnd] == '>')
+			{
+				string_view tagName = _source.substr(nameStart, nameEnd - nameStart);
+				string elseTag = "<!" + string(tagName) + ">";
+				string closingTag = "</" + string(tagName) + ">";
+				size_t bodyStart = nameEnd + 1;
+				size_t closingPos = _source.find(closingTag, bodyStart);
+				if (closingPos != string_view::npos)
+				{
+					// The else part belongs to the condition only if it comes before the closing tag.
+					size_t elsePos = _source.substr(0, closingPos).find(elseTag, bodyStart);
+					node.kind = nonEmptyCondition ? Node::Kind::NonEmptyCondition : Node::Kind::Condition;
+					node.name = string(nonEmptyCondition ? tagName.substr(1) : tagName);
+					if (elsePos == string_view::npos)
+						node.body = parse(_source.substr(bodyStart, closingPos - bodyStart));
+					else
+					{
+						size_t elseStart = elsePos + elseTag.size();
+						node.body = parse(_source.substr(bodyStart, elsePos - bodyStart));
+						node.elseBody = parse(_source.substr(elseStart, closingPos - elseStart));
+					}
+					end = closingPos + closingTag.size();
+				}
+			}
+		}
+
+		if (end == string_view::npos)
+			continue;
+
+		if (textStart < pos)
+		{
+			Node textNode;
+			textNode.text = _source.substr(textStart, pos - textStart);
+			result.nodes.emplace_back(move(textNode));
+		}
+		result.nodes.emplace_back(move(node));
+		textStart = end;
+		// Continue the search after the tag.
+		pos = end - 1;
+	}
+	if (textStart < _source.size())
+	{
+		Node textNode;
+		textNode.text = _source.substr(textStart);
+		result.nodes.emplace_back(move(textNode));
+	}
+	return result;
+}
+
 Whiskers::Whiskers(string _template):
-	m_template(move(_template))
+	m_template(CompiledTemplate::get(move(_template)))
 {
 }
 
@@ -71,14 +275,20 @@ Whiskers& Whiskers::operator()(
 
 string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	string result;
+	result.reserve(m_template->text.size());
+	render(m_template->block, nullptr, result);
+	return result;
 }
 
 void Whiskers::checkParameterValid(string const& _parameter) const
 {
-	static regex validParam("^" + paramRegex() + "$");
+	bool valid = !_parameter.empty();
+	for (char c: _parameter)
+		if (!isParameterCharacter(c))
+			valid = false;
 	assertThrow(
-		regex_match(_parameter, validParam),
+		valid,
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -107,126 +317,84 @@ void Whiskers::checkTemplateContainsTags(string const& _parameter, vector<string
 {
 	for (auto const& prefix: _prefixes)
 	{
-		string tag{"<" + prefix + _parameter + ">"};
+		string tag{prefix + _parameter};
 		assertThrow(
-			m_template.find(tag) != string::npos,
+			m_template->tags.count(tag),
 			WhiskersError,
-			"Tag '" + tag + "' not found in template:\n" + m_template
+			"Tag '<" + tag + ">' not found in template:\n" + m_template->text
 		);
 	}
 }
 
-namespace
-{
-template<class ReplaceCallback>
-string regex_replace(
-	string const& _source,
-	regex const& _pattern,
-	ReplaceCallback _replace,
-	regex_constants::match_flag_type _flags = regex_constants::match_default
-)
+void Whiskers::render(Block const& _block, StringMap const* _listElement, string& _output) const
 {
-	sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	sregex_iterator matchEnd;
-	string::const_iterator lastMatchedPos(_source.cbegin());
-	string result;
-	while (curMatch != matchEnd)
-	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
-	}
-	result.append(lastMatchedPos, _source.cend());
-	return result;
-}
-}
+	using Node = Block::Node;
 
-string Whiskers::replace(
-	string const& _template,
-	StringMap const& _parameters,
-	map<string, bool> const& _conditions,
-	map<string, vector<StringMap>> const& _listParameters
-)
-{
-	static regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](match_results<string::const_iterator> _match) -> string
-	{
-		string tagName(_match[1]);
-		string listName(_match[2]);
-		string conditionName(_match[4]);
-		if (!tagName.empty())
+	auto findValue = [&](string const& _name) -> string const* {
+		if (_listElement)
+			if (auto it = _listElement->find(_name); it != _listElement->end())
+				return &it->second;
+		if (auto it = m_parameters.find(_name); it != m_parameters.end())
+			return &it->second;
+		return nullptr;
+	};
+
+	for (Node const& node: _block.nodes)
+		switch (node.kind)
 		{
+		case Node::Kind::Text:
+			_output.append(node.text);
+			break;
+		case Node::Kind::Value:
+		{
+			string const* value = findValue(node.name);
 			assertThrow(
-				_parameters.count(tagName),
+				value,
 				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
+				"Value for tag " + node.name + " not provided.\n" +
 				"Template:\n" +
-				_template
+				string(_block.source)
+			);
+			_output.append(*value);
+			break;
+		}
+		case Node::Kind::List:
+		{
+			// Lists cannot be nested.
+			auto list = m_listParameters.find(node.name);
+			assertThrow(
+				!_listElement && list != m_listParameters.end(),
+				WhiskersError, "List parameter " + node.name + " not set."
 			);
-			return _parameters.at(tagName);
+			for (StringMap const& element: list->second)
+			{
+				for (auto const& value: element)
+					assertThrow(!m_parameters.count(value.first), WhiskersError, "Parameter collision");
+				render(node.body, &element, _output);
+			}
+			break;
 		}
-		else if (!listName.empty())
+		case Node::Kind::Condition:
 		{
-			string templ(_match[3]);
+			auto condition = m_conditions.find(node.name);
 			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
+				condition != m_conditions.end(),
+				WhiskersError, "Condition parameter " + node.name + " not set."
 			);
-			string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
+			render(condition->second ? node.body : node.elseBody, _listElement, _output);
+			break;
 		}
-		else
+		case Node::Kind::NonEmptyCondition:
 		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
 			bool conditionValue = false;
-			if (conditionName[0] == '+')
-			{
-				string tag = conditionName.substr(1);
-
-				if (_parameters.count(tag))
-					conditionValue = !_parameters.at(tag).empty();
-				else if (_listParameters.count(tag))
-					conditionValue = !_listParameters.at(tag).empty();
-				else
-					assertThrow(false, WhiskersError, "Tag " + tag + " used as condition but was not set.");
-			}
+			if (string const* value = findValue(node.name))
+				conditionValue = !value->empty();
+			else if (auto list = m_listParameters.find(node.name); !_listElement && list != m_listParameters.end())
+				conditionValue = !list->second.empty();
 			else
-			{
-				assertThrow(
-					_conditions.count(conditionName),
-					WhiskersError, "Condition parameter " + conditionName + " not set."
-				);
-				conditionValue = _conditions.at(conditionName);
-			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
-			);
+				assertThrow(false, WhiskersError, "Tag " + node.name + " used as condition but was not set.");
+			render(conditionValue ? node.body : node.elseBody, _listElement, _output);
+			break;
+		}
 		}
-	});
-}
-
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
-{
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
 }
-
@@ -26,8 +26,9 @@
 
 #include <libsolutil/Exceptions.h>
 
-#include <string>
 #include <map>
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace solidity::util
@@ -67,6 +68,8 @@ DEV_SIMPLE_EXCEPTION(WhiskersError);
  *    Works similar to a conditional parameter where the checked condition is
  *    that the string or list parameter called "name" is non-empty or contains
  *    no elements respectively.
+ *
+ * Templates are parsed once and the result is shared by all instances with the same template text.
  */
 class Whiskers
 {
@@ -90,30 +93,26 @@ public:
 	std::string render() const;
 
 private:
+	struct CompiledTemplate;
+	struct Block;
+
 	// Prevent implicit cast to bool
 	Whiskers& operator()(std::string _parameter, long long);
 	void checkParameterValid(std::string const& _parameter) const;
 	void checkParameterUnknown(std::string const& _parameter) const;
 
-	/// Checks whether the string stored in `m_template` contains all the tags specified.
+	/// Checks whether the template contains all the tags specified.
 	/// @param _parameter name of the parameter. This name is used to construct the tag(s).
 	/// @param _prefixes a vector of strings, where each element is used to compose the tag
 	///        like `"<" + element + _parameter + ">"`. Each element of _prefixes is used as a prefix of the tag name.
 	void checkTemplateContainsTags(std::string const& _parameter, std::vector<std::string> const& _prefixes) const;
 
-	static std::string replace(
-		std::string const& _template,
-		StringMap const& _parameters,
-		std::map<std::string, bool> const& _conditions,
-		StringListMap const& _listParameters = StringListMap()
-	);
-
-	static std::string paramRegex() { return "[a-zA-Z0-9_$-]+"; }
-
-	/// Joins the two maps throwing an exception if two keys are equal.
-	static StringMap joinMaps(StringMap const& _a, StringMap const& _b);
+	/// Appends the expansion of @a _block to @a _output.
+	/// @param _listElement values of the current list element, if inside a list.
+	void render(Block const& _block, StringMap const* _listElement, std::string& _output) const;
 
-	std::string m_template;
+	/// The parsed template, shared by all instances created for the same template text.
+	std::shared_ptr<CompiledTemplate const> m_template;
 	StringMap m_parameters;
 	std::map<std::string, bool> m_conditions;
 	StringListMap m_listParameters;
@@ -5,6 +5,7 @@
 #include <type_traits>
 #include <vector>
 #include <string>
+#include <string_view>
 
 #ifdef __INTEL_COMPILER
 #pragma warning(disable:597) // will not be called for implicit or explicit conversions
@@ -37,6 +38,10 @@ public:
 	vector_ref(string_type* _data): m_data(reinterpret_cast<T*>(_data->data())), m_count(_data->size() / sizeof(T)) {}
 	/// Creates a new vector_ref pointing to the data part of a string (given as reference).
 	vector_ref(string_type& _data): vector_ref(&_data) {}
+	/// Creates a new vector_ref pointing to the characters of a string view.
+	/// Only available for constant element types.
+	template <class U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+	vector_ref(std::string_view _data): m_data(reinterpret_cast<T*>(_data.data())), m_count(_data.size() / sizeof(T)) {}
 	/// Creates a new vector_ref pointing to the data part of a vector (given as pointer).
 	vector_ref(vector_type* _data): m_data(_data->data()), m_count(_data->size()) {}
 	explicit operator bool() const { return m_data && m_count; }
@@ -48,13 +48,23 @@ struct DebugData
 		astID(std::move(_astID))
 	{}
 
+	/// @returns shared debug data with the given content. Requests for empty debug data
+	/// all share a single instance, so that nodes created without a location do not allocate.
+	/// Other instances are not created const, so that their only owner may still modify them.
 	static std::shared_ptr<DebugData const> create(
 		langutil::SourceLocation _nativeLocation = {},
 		langutil::SourceLocation _originLocation = {},
 		std::optional<int64_t> _astID = {}
 	)
 	{
-		return std::make_shared<DebugData const>(
+		if (!_nativeLocation.isValid() && !_originLocation.isValid() && !_astID.has_value())
+		{
+			static std::shared_ptr<DebugData const> const empty = std::make_shared<DebugData const>(
+				langutil::SourceLocation{}
+			);
+			return empty;
+		}
+		return std::make_shared<DebugData>(
 			std::move(_nativeLocation),
 			std::move(_originLocation),
 			std::move(_astID)
@@ -81,27 +81,20 @@ void Parser::updateLocationEndFrom(
 {
 	solAssert(_debugData, "");
 
-	switch (m_useSourceLocationFrom)
-	{
-		case UseSourceLocationFrom::Scanner:
-		{
-			DebugData updatedDebugData = *_debugData;
-			updatedDebugData.nativeLocation.end = _location.end;
-			updatedDebugData.originLocation.end = _location.end;
-			_debugData = make_shared<DebugData const>(move(updatedDebugData));
-			break;
-		}
-		case UseSourceLocationFrom::LocationOverride:
-			// Ignore the update. The location we're overriding with is not supposed to change
-			break;
-		case UseSourceLocationFrom::Comments:
-		{
-			DebugData updatedDebugData = *_debugData;
-			updatedDebugData.nativeLocation.end = _location.end;
-			_debugData = make_shared<DebugData const>(move(updatedDebugData));
-			break;
-		}
-	}
+	if (m_useSourceLocationFrom == UseSourceLocationFrom::LocationOverride)
+		// Ignore the update. The location we're overriding with is not supposed to change
+		return;
+
+	// The node under construction is normally the only owner of its debug data,
+	// which can then be updated in place instead of being replaced by a copy.
+	shared_ptr<DebugData> updatedDebugData =
+		_debugData.use_count() == 1 ?
+		const_pointer_cast<DebugData>(_debugData) :
+		make_shared<DebugData>(*_debugData);
+	updatedDebugData->nativeLocation.end = _location.end;
+	if (m_useSourceLocationFrom == UseSourceLocationFrom::Scanner)
+		updatedDebugData->originLocation.end = _location.end;
+	_debugData = move(updatedDebugData);
 }
 
 unique_ptr<Block> Parser::parse(CharStream& _charStream)
@@ -34,6 +34,7 @@
 #include <libyul/backends/wasm/WasmObjectCompiler.h>
 #include <libyul/backends/wasm/EVMToEwasmTranslator.h>
 #include <libyul/ObjectParser.h>
+#include <libyul/optimiser/OptimisedCodeCache.h>
 #include <libyul/optimiser/Suite.h>
 
 #include <libevmasm/Assembly.h>
@@ -110,6 +111,17 @@ bool AssemblyStack::parseAndAnalyze(std::string const& _sourceName, std::string
 	return analyzeParsed();
 }
 
+void AssemblyStack::setAnalyzedObject(shared_ptr<Object> _object)
+{
+	yulAssert(_object, "");
+	yulAssert(_object->code, "");
+	yulAssert(_object->analysisInfo, "");
+	m_errors.clear();
+	m_charStream.reset();
+	m_parserResult = std::move(_object);
+	m_analysisSuccessful = true;
+}
+
 void AssemblyStack::optimize()
 {
 	if (!m_optimiserSettings.runYulOptimiser)
@@ -197,6 +209,18 @@ void AssemblyStack::optimize(Object& _object, bool _isCreation)
 			optimize(*subObject, false);
 
 	Dialect const& dialect = languageToDialect(m_language, m_evmVersion);
+	optional<util::h256> cacheKey;
+	if (m_optimisedCodeCache)
+	{
+		cacheKey = OptimisedCodeCache::key(dialect, _object, _isCreation);
+		if (unique_ptr<Block> optimisedCode = m_optimisedCodeCache->find(*cacheKey))
+		{
+			// The analysis info is recreated once the whole object has been optimized.
+			*_object.code = std::move(*optimisedCode);
+			return;
+		}
+	}
+
 	unique_ptr<GasMeter> meter;
 	if (EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&dialect))
 		meter = make_unique<GasMeter>(*evmDialect, _isCreation, m_optimiserSettings.expectedExecutionsPerDeployment);
@@ -207,8 +231,12 @@ void AssemblyStack::optimize(Object& _object, bool _isCreation)
 		m_optimiserSettings.optimizeStackAllocation,
 		m_optimiserSettings.yulOptimiserSteps,
 		_isCreation ? nullopt : make_optional(m_optimiserSettings.expectedExecutionsPerDeployment),
-		{}
+		{},
+		m_optimiserParallelism
 	);
+
+	if (cacheKey)
+		m_optimisedCodeCache->store(*cacheKey, *_object.code);
 }
 
 MachineAssemblyObject AssemblyStack::assemble(Machine _machine) const
@@ -285,7 +313,7 @@ AssemblyStack::assembleEVMWithDeployed(optional<string_view> _deployName) const
 	EthAssemblyAdapter adapter(assembly);
 	compileEVM(adapter, m_optimiserSettings.optimizeStackAllocation);
 
-	assembly.optimise(translateOptimiserSettings(m_optimiserSettings, m_evmVersion));
+	assembly.optimise(translateOptimiserSettings(m_optimiserSettings, m_evmVersion), m_optimiserParallelism);
 
 	optional<size_t> subIndex;
 
@@ -34,6 +34,7 @@
 
 #include <libevmasm/LinkerObject.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -50,6 +51,7 @@ class Scanner;
 namespace solidity::yul
 {
 class AbstractAssembly;
+class OptimisedCodeCache;
 
 
 struct MachineAssemblyObject
@@ -98,10 +100,25 @@ public:
 	/// Multiple calls overwrite the previous state.
 	bool parseAndAnalyze(std::string const& _sourceName, std::string const& _source);
 
+	/// Takes over an object that has already been parsed and analyzed in the same language,
+	/// e.g. the result of another assembly stack, without printing and re-parsing it.
+	/// The object is modified by subsequent optimization steps.
+	/// Multiple calls overwrite the previous state.
+	void setAnalyzedObject(std::shared_ptr<Object> _object);
+
 	/// Run the optimizer suite. Can only be used with Yul or strict assembly.
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
 	void optimize();
 
+	/// Sets the maximum number of threads the optimizer may use to optimize the functions
+	/// of an object and the sub-assemblies of the generated EVM assembly concurrently.
+	/// The result does not depend on this setting.
+	void setOptimiserParallelism(size_t _parallelism) { m_optimiserParallelism = std::max<size_t>(1, _parallelism); }
+
+	/// Sets a cache the optimizer takes the code of objects from that were already optimized
+	/// and stores its own results in. Can be shared between stacks with the same settings.
+	void setOptimisedCodeCache(std::shared_ptr<OptimisedCodeCache> _cache) { m_optimisedCodeCache = std::move(_cache); }
+
 	/// Translate the source to a different language / dialect.
 	void translate(Language _targetLanguage);
 
@@ -147,6 +164,8 @@ private:
 	Language m_language = Language::Assembly;
 	langutil::EVMVersion m_evmVersion;
 	solidity::frontend::OptimiserSettings m_optimiserSettings;
+	size_t m_optimiserParallelism = 1;
+	std::shared_ptr<OptimisedCodeCache> m_optimisedCodeCache;
 	langutil::DebugInfoSelection m_debugInfoSelection{};
 
 	std::unique_ptr<langutil::CharStream> m_charStream;
@@ -0,0 +1,148 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * String abstraction that avoids copies.
+ */
+
+#include <libyul/YulString.h>
+
+#include <libyul/Exceptions.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace
+{
+
+mutex& resetCallbacksMutex()
+{
+	static mutex callbacksMutex;
+	return callbacksMutex;
+}
+
+vector<function<void()>>& resetCallbacks()
+{
+	static vector<function<void()>> callbacks;
+	return callbacks;
+}
+
+mutex sessionMutex;
+size_t activeSessions = 0;
+
+}
+
+YulStringRepository::YulStringRepository():
+	m_blocks(new atomic<string*>[maxBlocks]())
+{
+	blockFor(0);
+}
+
+YulStringRepository::~YulStringRepository()
+{
+	clear();
+	delete[] m_blocks[0].load();
+}
+
+YulStringRepository::Handle YulStringRepository::stringToHandle(string const& _string)
+{
+	if (_string.empty())
+		return { 0, emptyHash() };
+	uint64_t h = hash(_string);
+	Shard& shard = m_shards[h % shardCount];
+	lock_guard<mutex> lock(shard.mutex);
+	auto range = shard.hashToID.equal_range(h);
+	for (auto it = range.first; it != range.second; ++it)
+		if (idToString(it->second) == _string)
+			return Handle{it->second, h};
+	// The string is written before the ID is published through the shard or the returned
+	// handle, so readers never observe a partially constructed string.
+	size_t id = m_size.fetch_add(1, memory_order_relaxed);
+	blockFor(id)[id & (blockSize - 1)] = _string;
+	shard.hashToID.emplace_hint(range.second, make_pair(h, id));
+
+	return Handle{id, h};
+}
+
+void YulStringRepository::reset()
+{
+	{
+		lock_guard<mutex> lock(resetCallbacksMutex());
+		for (auto const& cb: resetCallbacks())
+			cb();
+	}
+	instance().clear();
+}
+
+YulStringRepository::ResetCallback::ResetCallback(function<void()> _fun)
+{
+	lock_guard<mutex> lock(resetCallbacksMutex());
+	resetCallbacks().emplace_back(std::move(_fun));
+}
+
+void YulStringRepository::resetUnlessInSession()
+{
+	lock_guard<mutex> lock(sessionMutex);
+	if (activeSessions == 0)
+		reset();
+}
+
+YulStringRepository::Session::Session()
+{
+	lock_guard<mutex> lock(sessionMutex);
+	++activeSessions;
+}
+
+YulStringRepository::Session::~Session()
+{
+	lock_guard<mutex> lock(sessionMutex);
+	yulAssert(activeSessions > 0, "");
+	if (--activeSessions == 0)
+		reset();
+}
+
+void YulStringRepository::clear()
+{
+	for (Shard& shard: m_shards)
+	{
+		lock_guard<mutex> lock(shard.mutex);
+		shard.hashToID.clear();
+	}
+	size_t usedBlocks = (m_size.load() + blockSize - 1) >> blockBits;
+	// The first block containing the empty string is kept.
+	for (size_t i = 1; i < usedBlocks; ++i)
+		delete[] m_blocks[i].exchange(nullptr);
+	string* firstBlock = m_blocks[0].load();
+	for (size_t i = 1; i < blockSize; ++i)
+		string().swap(firstBlock[i]);
+	m_size = 1;
+}
+
+string* YulStringRepository::blockFor(size_t _id)
+{
+	size_t index = _id >> blockBits;
+	yulAssert(index < maxBlocks, "Too many Yul strings.");
+	string* block = m_blocks[index].load(memory_order_acquire);
+	if (!block)
+	{
+		auto newBlock = make_unique<string[]>(blockSize);
+		if (m_blocks[index].compare_exchange_strong(block, newBlock.get(), memory_order_acq_rel))
+			block = newBlock.release();
+	}
+	return block;
+}
@@ -23,8 +23,11 @@
 
 #include <fmt/format.h>
 
+#include <array>
+#include <atomic>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <functional>
@@ -36,6 +39,11 @@ namespace solidity::yul
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
 /// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
 /// non-deterministic) and a deterministic string hash.
+///
+/// The strings are stored in blocks that are never moved or freed before a reset, so that
+/// looking up the string of a handle does not require any locking. Insertions are distributed
+/// over several shards by their hash, which allows multiple threads to intern strings at the
+/// same time.
 class YulStringRepository
 {
 public:
@@ -51,22 +59,12 @@ public:
 		return inst;
 	}
 
-	Handle stringToHandle(std::string const& _string)
+	Handle stringToHandle(std::string const& _string);
+	std::string const& idToString(size_t _id) const
 	{
-		if (_string.empty())
-			return { 0, emptyHash() };
-		std::uint64_t h = hash(_string);
-		auto range = m_hashToID.equal_range(h);
-		for (auto it = range.first; it != range.second; ++it)
-			if (*m_strings[it->second] == _string)
-				return Handle{it->second, h};
-		m_strings.emplace_back(std::make_shared<std::string>(_string));
-		size_t id = m_strings.size() - 1;
-		m_hashToID.emplace_hint(range.second, std::make_pair(h, id));
-
-		return Handle{id, h};
+		std::string const* block = m_blocks[_id >> blockBits].load(std::memory_order_acquire);
+		return block[_id & (blockSize - 1)];
 	}
-	std::string const& idToString(size_t _id) const	{ return *m_strings.at(_id); }
 
 	static std::uint64_t hash(std::string const& v)
 	{
@@ -82,40 +80,64 @@ public:
 	}
 	static constexpr std::uint64_t emptyHash() { return 14695981039346656037u; }
 	/// Clear the repository.
-	/// Use with care - there cannot be any dangling YulString references.
+	/// Use with care - there cannot be any dangling YulString references and no other
+	/// thread may use the repository at the same time.
 	/// If references need to be cleared manually, register the callback via
 	/// resetCallback.
-	static void reset()
-	{
-		for (auto const& cb: resetCallbacks())
-			cb();
-		instance() = YulStringRepository{};
-	}
+	static void reset();
+	/// Resets the repository unless a session is active.
+	/// No thread may use the repository outside of a session at the same time.
+	static void resetUnlessInSession();
 	/// Struct that registers a reset callback as a side-effect of its construction.
 	/// Useful as static local variable to register a reset callback once.
 	struct ResetCallback
 	{
-		ResetCallback(std::function<void()> _fun)
-		{
-			YulStringRepository::resetCallbacks().emplace_back(std::move(_fun));
-		}
+		ResetCallback(std::function<void()> _fun);
+	};
+	/// Marks the lifetime of a compilation that uses the repository.
+	/// When the last active session ends, the repository is reset, so that the memory
+	/// is reclaimed without invalidating strings that are still used by other
+	/// compilations running at the same time.
+	/// CompilerStack holds a session from parsing until it is reset. Code that uses Yul
+	/// directly, e.g. through AssemblyStack, has to hold one itself while other compilations
+	/// may end at the same time.
+	class Session
+	{
+	public:
+		Session();
+		~Session();
+		Session(Session const&) = delete;
+		Session& operator=(Session const&) = delete;
 	};
 
 private:
-	YulStringRepository() = default;
+	YulStringRepository();
+	~YulStringRepository();
 	YulStringRepository(YulStringRepository const&) = delete;
-	YulStringRepository(YulStringRepository&&) = default;
 	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
-	YulStringRepository& operator=(YulStringRepository&& _rhs) = default;
 
-	static std::vector<std::function<void()>>& resetCallbacks()
+	/// Removes all strings apart from the empty string.
+	void clear();
+	/// @returns the block that stores the string with the given ID, allocating it if needed.
+	std::string* blockFor(size_t _id);
+
+	static constexpr size_t blockBits = 10;
+	static constexpr size_t blockSize = size_t(1) << blockBits;
+	static constexpr size_t maxBlocks = size_t(1) << 16;
+	static constexpr size_t shardCount = 16;
+
+	struct Shard
 	{
-		static std::vector<std::function<void()>> callbacks;
-		return callbacks;
-	}
+		std::mutex mutex;
+		std::unordered_multimap<std::uint64_t, size_t> hashToID;
+	};
 
-	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
-	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
+	/// Blocks of blockSize strings each, the string with ID i is stored at offset
+	/// i % blockSize of block i / blockSize.
+	std::unique_ptr<std::atomic<std::string*>[]> m_blocks;
+	/// Number of IDs that have been handed out, including the empty string.
+	std::atomic<size_t> m_size{1};
+	std::array<Shard, shardCount> m_shards;
 };
 
 /// Wrapper around handles into the YulString repository.
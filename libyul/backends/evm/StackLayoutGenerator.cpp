@@ -25,6 +25,7 @@
 
 #include <libsolutil/Algorithms.h>
 #include <libsolutil/cxx20.h>
+#include <libsolutil/Profiler.h>
 #include <libsolutil/Visitor.h>
 
 #include <range/v3/algorithm/any_of.hpp>
@@ -48,6 +49,7 @@ using namespace std;
 
 StackLayout StackLayoutGenerator::run(CFG const& _cfg)
 {
+	util::ProfilerScope profilerScope("yulCodegen", "StackLayoutGenerator");
 	StackLayout stackLayout;
 	StackLayoutGenerator{stackLayout}.processEntryPoint(*_cfg.entry);
 
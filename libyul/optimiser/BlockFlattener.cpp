@@ -34,10 +34,13 @@ void BlockFlattener::operator()(Block& _block)
 
 	iterateReplacing(
 		_block.statements,
-		[](Statement& _s) -> std::optional<vector<Statement>>
+		[&](Statement& _s) -> std::optional<vector<Statement>>
 		{
 			if (holds_alternative<Block>(_s))
+			{
+				m_changed = true;
 				return std::move(std::get<Block>(_s).statements);
+			}
 			else
 				return {};
 		}
@@ -27,13 +27,21 @@ class BlockFlattener: public ASTModifier
 {
 public:
 	static constexpr char const* name{"BlockFlattener"};
-	static void run(OptimiserStepContext&, Block& _ast) { BlockFlattener{}(_ast); }
+	/// @returns true if a block was flattened.
+	static bool run(OptimiserStepContext&, Block& _ast)
+	{
+		BlockFlattener flattener;
+		flattener(_ast);
+		return flattener.m_changed;
+	}
 
 	using ASTModifier::operator();
 	void operator()(Block& _block) override;
 
 private:
 	BlockFlattener() = default;
+
+	bool m_changed = false;
 };
 
 }
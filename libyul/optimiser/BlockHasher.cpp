@@ -16,7 +16,7 @@
 */
 // SPDX-License-Identifier: GPL-3.0
 /**
- * Optimiser component that calculates hash values for block prefixes.
+ * Optimiser components that calculate hash values for blocks.
  */
 
 #include <libyul/optimiser/BlockHasher.h>
@@ -192,3 +192,159 @@ void BlockHasher::operator()(Block const& _block)
 	for (auto& externalReference: subBlockHasher.m_externalReferences)
 		(*this)(Identifier{{}, externalReference});
 }
+
+uint64_t ASTHasher::run(Block const& _block)
+{
+	ASTHasher hasher;
+	hasher(_block);
+	return hasher.m_hash;
+}
+
+void ASTHasher::operator()(Literal const& _literal)
+{
+	hash64(compileTimeLiteralHash("Literal"));
+	hashDebugData(_literal.debugData);
+	hash64(_literal.value.hash());
+	hash64(_literal.type.hash());
+	hash8(static_cast<uint8_t>(_literal.kind));
+}
+
+void ASTHasher::operator()(Identifier const& _identifier)
+{
+	hash64(compileTimeLiteralHash("Identifier"));
+	hashDebugData(_identifier.debugData);
+	hash64(_identifier.name.hash());
+}
+
+void ASTHasher::operator()(FunctionCall const& _funCall)
+{
+	hash64(compileTimeLiteralHash("FunctionCall"));
+	hashDebugData(_funCall.debugData);
+	(*this)(_funCall.functionName);
+	hash64(_funCall.arguments.size());
+	ASTWalker::operator()(_funCall);
+}
+
+void ASTHasher::operator()(ExpressionStatement const& _statement)
+{
+	hash64(compileTimeLiteralHash("ExpressionStatement"));
+	hashDebugData(_statement.debugData);
+	ASTWalker::operator()(_statement);
+}
+
+void ASTHasher::operator()(Assignment const& _assignment)
+{
+	hash64(compileTimeLiteralHash("Assignment"));
+	hashDebugData(_assignment.debugData);
+	hash64(_assignment.variableNames.size());
+	for (auto const& name: _assignment.variableNames)
+		(*this)(name);
+	visit(*_assignment.value);
+}
+
+void ASTHasher::operator()(VariableDeclaration const& _varDecl)
+{
+	hash64(compileTimeLiteralHash("VariableDeclaration"));
+	hashDebugData(_varDecl.debugData);
+	hashTypedNames(_varDecl.variables);
+	hash8(_varDecl.value ? 1 : 0);
+	ASTWalker::operator()(_varDecl);
+}
+
+void ASTHasher::operator()(If const& _if)
+{
+	hash64(compileTimeLiteralHash("If"));
+	hashDebugData(_if.debugData);
+	ASTWalker::operator()(_if);
+}
+
+void ASTHasher::operator()(Switch const& _switch)
+{
+	hash64(compileTimeLiteralHash("Switch"));
+	hashDebugData(_switch.debugData);
+	hash64(_switch.cases.size());
+	visit(*_switch.expression);
+	for (auto const& _case: _switch.cases)
+	{
+		hashDebugData(_case.debugData);
+		hash8(_case.value ? 1 : 0);
+		if (_case.value)
+			(*this)(*_case.value);
+		(*this)(_case.body);
+	}
+}
+
+void ASTHasher::operator()(FunctionDefinition const& _funDef)
+{
+	hash64(compileTimeLiteralHash("FunctionDefinition"));
+	hashDebugData(_funDef.debugData);
+	hash64(_funDef.name.hash());
+	hashTypedNames(_funDef.parameters);
+	hashTypedNames(_funDef.returnVariables);
+	(*this)(_funDef.body);
+}
+
+void ASTHasher::operator()(ForLoop const& _loop)
+{
+	hash64(compileTimeLiteralHash("ForLoop"));
+	hashDebugData(_loop.debugData);
+	ASTWalker::operator()(_loop);
+}
+
+void ASTHasher::operator()(Break const& _break)
+{
+	hash64(compileTimeLiteralHash("Break"));
+	hashDebugData(_break.debugData);
+}
+
+void ASTHasher::operator()(Continue const& _continue)
+{
+	hash64(compileTimeLiteralHash("Continue"));
+	hashDebugData(_continue.debugData);
+}
+
+void ASTHasher::operator()(Leave const& _leaveStatement)
+{
+	hash64(compileTimeLiteralHash("Leave"));
+	hashDebugData(_leaveStatement.debugData);
+}
+
+void ASTHasher::operator()(Block const& _block)
+{
+	hash64(compileTimeLiteralHash("Block"));
+	hashDebugData(_block.debugData);
+	hash64(_block.statements.size());
+	ASTWalker::operator()(_block);
+}
+
+void ASTHasher::hashDebugData(shared_ptr<DebugData const> const& _debugData)
+{
+	// Debug data is hashed by content. Its address could be reused after a step freed it.
+	// Source names are owned by the object being optimised, so their addresses are stable.
+	auto hashLocation = [&](langutil::SourceLocation const& _location) {
+		hash64(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(_location.sourceName.get())));
+		hash32(static_cast<uint32_t>(_location.start));
+		hash32(static_cast<uint32_t>(_location.end));
+	};
+	if (!_debugData)
+	{
+		hash8(0);
+		return;
+	}
+	hash8(1);
+	hashLocation(_debugData->nativeLocation);
+	hashLocation(_debugData->originLocation);
+	hash8(static_cast<uint8_t>(_debugData->astID.has_value()));
+	hash64(static_cast<uint64_t>(_debugData->astID.value_or(0)));
+}
+
+void ASTHasher::hashTypedNames(vector<TypedName> const& _names)
+{
+	hash64(_names.size());
+	for (TypedName const& name: _names)
+	{
+		hashDebugData(name.debugData);
+		hash64(name.name.hash());
+		hash64(name.type.hash());
+	}
+}
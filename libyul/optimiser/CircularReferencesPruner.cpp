@@ -26,9 +26,11 @@
 using namespace std;
 using namespace solidity::yul;
 
-void CircularReferencesPruner::run(OptimiserStepContext& _context, Block& _ast)
+bool CircularReferencesPruner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	CircularReferencesPruner{_context.reservedIdentifiers}(_ast);
+	CircularReferencesPruner pruner{_context.reservedIdentifiers};
+	pruner(_ast);
+	return pruner.m_changed;
 }
 
 void CircularReferencesPruner::operator()(Block& _block)
@@ -36,6 +38,7 @@ void CircularReferencesPruner::operator()(Block& _block)
 	set<YulString> functionsToKeep =
 		functionsCalledFromOutermostContext(CallGraphGenerator::callGraph(_block));
 
+	size_t statementCount = _block.statements.size();
 	for (auto&& statement: _block.statements)
 		if (holds_alternative<FunctionDefinition>(statement))
 		{
@@ -45,6 +48,8 @@ void CircularReferencesPruner::operator()(Block& _block)
 		}
 
 	removeEmptyBlocks(_block);
+	if (_block.statements.size() != statementCount)
+		m_changed = true;
 }
 
 set<YulString> CircularReferencesPruner::functionsCalledFromOutermostContext(CallGraph const& _callGraph)
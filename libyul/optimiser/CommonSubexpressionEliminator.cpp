@@ -23,6 +23,7 @@
 
 #include <libyul/optimiser/SyntacticalEquality.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/SideEffects.h>
 #include <libyul/Exceptions.h>
@@ -35,13 +36,28 @@ using namespace solidity;
 using namespace solidity::yul;
 using namespace solidity::util;
 
-void CommonSubexpressionEliminator::run(OptimiserStepContext& _context, Block& _ast)
+bool CommonSubexpressionEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
 	CommonSubexpressionEliminator cse{
 		_context.dialect,
 		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
 	};
 	cse(_ast);
+	return cse.m_changed;
+}
+
+bool CommonSubexpressionEliminator::runInParallel(OptimiserStepContext& _context, Block& _ast, size_t _parallelism)
+{
+	map<YulString, SideEffects> functionSideEffects =
+		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
+	return visitFunctionsInParallel(
+		_ast,
+		_parallelism,
+		[&]() {
+			return unique_ptr<ASTModifier>(new CommonSubexpressionEliminator{_context.dialect, functionSideEffects});
+		},
+		[](ASTModifier const& _cse) { return static_cast<CommonSubexpressionEliminator const&>(_cse).m_changed; }
+	);
 }
 
 CommonSubexpressionEliminator::CommonSubexpressionEliminator(
@@ -100,7 +116,10 @@ void CommonSubexpressionEliminator::visit(Expression& _e)
 			assertThrow(m_value.at(identifierName).value, OptimizerException, "");
 			if (Identifier const* value = get_if<Identifier>(m_value.at(identifierName).value))
 				if (inScope(value->name))
+				{
 					_e = Identifier{debugDataOf(_e), value->name};
+					m_changed = true;
+				}
 		}
 	}
 	else
@@ -120,6 +139,7 @@ void CommonSubexpressionEliminator::visit(Expression& _e)
 			if (SyntacticallyEqual{}(_e, *value.value) && inScope(variable))
 			{
 				_e = Identifier{debugDataOf(_e), variable};
+				m_changed = true;
 				break;
 			}
 		}
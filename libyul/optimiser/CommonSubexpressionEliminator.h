@@ -43,7 +43,10 @@ class CommonSubexpressionEliminator: public DataFlowAnalyzer
 {
 public:
 	static constexpr char const* name{"CommonSubexpressionEliminator"};
-	static void run(OptimiserStepContext&, Block& _ast);
+	/// @returns true if an expression was replaced.
+	static bool run(OptimiserStepContext&, Block& _ast);
+	/// Same as run(), but optimises the functions of @a _ast concurrently.
+	static bool runInParallel(OptimiserStepContext&, Block& _ast, size_t _parallelism);
 
 	using DataFlowAnalyzer::operator();
 	void operator()(FunctionDefinition&) override;
@@ -60,6 +63,7 @@ protected:
 
 private:
 	std::set<YulString> m_returnVariables;
+	bool m_changed = false;
 };
 
 }
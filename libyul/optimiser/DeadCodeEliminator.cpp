@@ -35,13 +35,15 @@ using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::yul;
 
-void DeadCodeEliminator::run(OptimiserStepContext& _context, Block& _ast)
+bool DeadCodeEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
 	ControlFlowSideEffectsCollector sideEffects(_context.dialect, _ast);
-	DeadCodeEliminator{
+	DeadCodeEliminator eliminator{
 		_context.dialect,
 		sideEffects.functionSideEffectsNamed()
-	}(_ast);
+	};
+	eliminator(_ast);
+	return eliminator.m_changed;
 }
 
 void DeadCodeEliminator::operator()(ForLoop& _for)
@@ -58,14 +60,16 @@ void DeadCodeEliminator::operator()(Block& _block)
 
 	// Erase everything after the terminating statement that is not a function definition.
 	if (controlFlowChange != TerminationFinder::ControlFlow::FlowOut && index != std::numeric_limits<size_t>::max())
-		_block.statements.erase(
-			remove_if(
-				_block.statements.begin() + static_cast<ptrdiff_t>(index) + 1,
-				_block.statements.end(),
-				[] (Statement const& _s) { return !holds_alternative<yul::FunctionDefinition>(_s); }
-			),
-			_block.statements.end()
+	{
+		auto unreachable = remove_if(
+			_block.statements.begin() + static_cast<ptrdiff_t>(index) + 1,
+			_block.statements.end(),
+			[] (Statement const& _s) { return !holds_alternative<yul::FunctionDefinition>(_s); }
 		);
+		if (unreachable != _block.statements.end())
+			m_changed = true;
+		_block.statements.erase(unreachable, _block.statements.end());
+	}
 
 	ASTModifier::operator()(_block);
 }
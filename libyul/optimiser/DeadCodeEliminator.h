@@ -53,7 +53,8 @@ class DeadCodeEliminator: public ASTModifier
 {
 public:
 	static constexpr char const* name{"DeadCodeEliminator"};
-	static void run(OptimiserStepContext&, Block& _ast);
+	/// @returns true if a statement was removed.
+	static bool run(OptimiserStepContext&, Block& _ast);
 
 	using ASTModifier::operator();
 	void operator()(ForLoop& _for) override;
@@ -67,6 +68,7 @@ private:
 
 	Dialect const& m_dialect;
 	std::map<YulString, ControlFlowSideEffects> m_functionSideEffects;
+	bool m_changed = false;
 };
 
 }
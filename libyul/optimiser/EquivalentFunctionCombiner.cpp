@@ -27,15 +27,20 @@ using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
 
-void EquivalentFunctionCombiner::run(OptimiserStepContext&, Block& _ast)
+bool EquivalentFunctionCombiner::run(OptimiserStepContext&, Block& _ast)
 {
-	EquivalentFunctionCombiner{EquivalentFunctionDetector::run(_ast)}(_ast);
+	EquivalentFunctionCombiner combiner{EquivalentFunctionDetector::run(_ast)};
+	combiner(_ast);
+	return combiner.m_changed;
 }
 
 void EquivalentFunctionCombiner::operator()(FunctionCall& _funCall)
 {
 	auto it = m_duplicates.find(_funCall.functionName.name);
-	if (it != m_duplicates.end())
+	if (it != m_duplicates.end() && it->second->name != _funCall.functionName.name)
+	{
 		_funCall.functionName.name = it->second->name;
+		m_changed = true;
+	}
 	ASTModifier::operator()(_funCall);
 }
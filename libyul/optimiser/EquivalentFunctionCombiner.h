@@ -40,7 +40,8 @@ class EquivalentFunctionCombiner: public ASTModifier
 {
 public:
 	static constexpr char const* name{"EquivalentFunctionCombiner"};
-	static void run(OptimiserStepContext&, Block& _ast);
+	/// @returns true if a call was redirected to an equivalent function.
+	static bool run(OptimiserStepContext&, Block& _ast);
 
 	using ASTModifier::operator();
 	void operator()(FunctionCall& _funCall) override;
@@ -48,6 +49,7 @@ public:
 private:
 	EquivalentFunctionCombiner(std::map<YulString, FunctionDefinition const*> _duplicates): m_duplicates(std::move(_duplicates)) {}
 	std::map<YulString, FunctionDefinition const*> m_duplicates;
+	bool m_changed = false;
 };
 
 
@@ -23,15 +23,28 @@
 
 #include <libyul/optimiser/SimplificationRules.h>
 #include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/AST.h>
 
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
 
-void ExpressionSimplifier::run(OptimiserStepContext& _context, Block& _ast)
+bool ExpressionSimplifier::run(OptimiserStepContext& _context, Block& _ast)
 {
-	ExpressionSimplifier{_context.dialect}(_ast);
+	ExpressionSimplifier simplifier{_context.dialect};
+	simplifier(_ast);
+	return simplifier.m_changed;
+}
+
+bool ExpressionSimplifier::runInParallel(OptimiserStepContext& _context, Block& _ast, size_t _parallelism)
+{
+	return visitFunctionsInParallel(
+		_ast,
+		_parallelism,
+		[&]() { return unique_ptr<ASTModifier>(new ExpressionSimplifier{_context.dialect}); },
+		[](ASTModifier const& _simplifier) { return static_cast<ExpressionSimplifier const&>(_simplifier).m_changed; }
+	);
 }
 
 void ExpressionSimplifier::visit(Expression& _expression)
@@ -39,5 +52,8 @@ void ExpressionSimplifier::visit(Expression& _expression)
 	ASTModifier::visit(_expression);
 
 	while (auto const* match = SimplificationRules::findFirstMatch(_expression, m_dialect, m_value))
+	{
 		_expression = match->action().toExpression(debugDataOf(_expression));
+		m_changed = true;
+	}
 }
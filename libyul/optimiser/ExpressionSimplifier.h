@@ -45,13 +45,18 @@ class ExpressionSimplifier: public DataFlowAnalyzer
 {
 public:
 	static constexpr char const* name{"ExpressionSimplifier"};
-	static void run(OptimiserStepContext&, Block& _ast);
+	/// @returns true if an expression was simplified.
+	static bool run(OptimiserStepContext&, Block& _ast);
+	/// Same as run(), but optimises the functions of @a _ast concurrently.
+	static bool runInParallel(OptimiserStepContext&, Block& _ast, size_t _parallelism);
 
 	using ASTModifier::operator();
 	void visit(Expression& _expression) override;
 
 private:
 	explicit ExpressionSimplifier(Dialect const& _dialect): DataFlowAnalyzer(_dialect) {}
+
+	bool m_changed = false;
 };
 
 }
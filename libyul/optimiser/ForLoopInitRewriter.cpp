@@ -38,6 +38,8 @@ void ForLoopInitRewriter::operator()(Block& _block)
 				(*this)(forLoop.pre);
 				(*this)(forLoop.body);
 				(*this)(forLoop.post);
+				if (!forLoop.pre.statements.empty())
+					m_changed = true;
 				vector<Statement> rewrite;
 				swap(rewrite, forLoop.pre.statements);
 				rewrite.emplace_back(move(forLoop));
@@ -32,9 +32,12 @@ class ForLoopInitRewriter: public ASTModifier
 {
 public:
 	static constexpr char const* name{"ForLoopInitRewriter"};
-	static void run(OptimiserStepContext&, Block& _ast)
+	/// @returns true if the init block of a for loop was moved.
+	static bool run(OptimiserStepContext&, Block& _ast)
 	{
-		ForLoopInitRewriter{}(_ast);
+		ForLoopInitRewriter rewriter;
+		rewriter(_ast);
+		return rewriter.m_changed;
 	}
 
 	using ASTModifier::operator();
@@ -42,6 +45,8 @@ public:
 
 private:
 	ForLoopInitRewriter() = default;
+
+	bool m_changed = false;
 };
 
 }
@@ -33,6 +33,7 @@ void FunctionGrouper::operator()(Block& _block)
 {
 	if (alreadyGrouped(_block))
 		return;
+	m_changed = true;
 
 	vector<Statement> reordered;
 	reordered.emplace_back(Block{_block.debugData, {}});
@@ -41,7 +41,13 @@ class FunctionGrouper
 {
 public:
 	static constexpr char const* name{"FunctionGrouper"};
-	static void run(OptimiserStepContext&, Block& _ast) { FunctionGrouper{}(_ast); }
+	/// @returns true if the statements were not grouped yet.
+	static bool run(OptimiserStepContext&, Block& _ast)
+	{
+		FunctionGrouper grouper;
+		grouper(_ast);
+		return grouper.m_changed;
+	}
 
 	void operator()(Block& _block);
 
@@ -49,6 +55,8 @@ private:
 	FunctionGrouper() = default;
 
 	bool alreadyGrouped(Block const& _block);
+
+	bool m_changed = false;
 };
 
 }
@@ -26,6 +26,7 @@
 #include <libyul/backends/evm/EVMMetrics.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/SideEffects.h>
 #include <libyul/AST.h>
 #include <libyul/Utilities.h>
@@ -41,15 +42,37 @@ using namespace solidity::util;
 using namespace solidity::evmasm;
 using namespace solidity::yul;
 
-void LoadResolver::run(OptimiserStepContext& _context, Block& _ast)
+bool LoadResolver::run(OptimiserStepContext& _context, Block& _ast)
 {
 	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
-	LoadResolver{
+	LoadResolver resolver{
 		_context.dialect,
 		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
 		containsMSize,
 		_context.expectedExecutionsPerDeployment
-	}(_ast);
+	};
+	resolver(_ast);
+	return resolver.m_changed;
+}
+
+bool LoadResolver::runInParallel(OptimiserStepContext& _context, Block& _ast, size_t _parallelism)
+{
+	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
+	map<YulString, SideEffects> functionSideEffects =
+		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
+	return visitFunctionsInParallel(
+		_ast,
+		_parallelism,
+		[&]() {
+			return unique_ptr<ASTModifier>(new LoadResolver{
+				_context.dialect,
+				functionSideEffects,
+				containsMSize,
+				_context.expectedExecutionsPerDeployment
+			});
+		},
+		[](ASTModifier const& _resolver) { return static_cast<LoadResolver const&>(_resolver).m_changed; }
+	);
 }
 
 void LoadResolver::visit(Expression& _e)
@@ -84,12 +107,18 @@ void LoadResolver::tryResolve(
 	{
 		if (auto value = util::valueOrNullptr(m_storage, key))
 			if (inScope(*value))
+			{
 				_e = Identifier{debugDataOf(_e), *value};
+				m_changed = true;
+			}
 	}
 	else if (!m_containsMSize && _location == StoreLoadLocation::Memory)
 		if (auto value = util::valueOrNullptr(m_memory, key))
 			if (inScope(*value))
+			{
 				_e = Identifier{debugDataOf(_e), *value};
+				m_changed = true;
+			}
 }
 
 void LoadResolver::tryEvaluateKeccak(
@@ -144,6 +173,7 @@ void LoadResolver::tryEvaluateKeccak(
 				YulString{u256(keccak256(contentAsBytes)).str()},
 				m_dialect.defaultType
 			};
+			m_changed = true;
 		}
 	}
 }
@@ -44,7 +44,10 @@ class LoadResolver: public DataFlowAnalyzer
 public:
 	static constexpr char const* name{"LoadResolver"};
 	/// Run the load resolver on the given complete AST.
-	static void run(OptimiserStepContext&, Block& _ast);
+	/// @returns true if a load or hash was resolved.
+	static bool run(OptimiserStepContext&, Block& _ast);
+	/// Same as run(), but optimises the functions of @a _ast concurrently.
+	static bool runInParallel(OptimiserStepContext&, Block& _ast, size_t _parallelism);
 
 private:
 	LoadResolver(
@@ -79,6 +82,7 @@ protected:
 	bool m_containsMSize = false;
 	/// The --optimize-runs parameter. Value `nullopt` represents creation code.
 	std::optional<size_t> m_expectedExecutionsPerDeployment;
+	bool m_changed = false;
 };
 
 }
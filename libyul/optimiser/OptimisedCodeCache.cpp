@@ -0,0 +1,86 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/optimiser/OptimisedCodeCache.h>
+
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/AsmPrinter.h>
+#include <libyul/AST.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Object.h>
+
+#include <libsolutil/Keccak256.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+using namespace solidity::util;
+
+h256 OptimisedCodeCache::key(Dialect const& _dialect, Object const& _object, bool _isCreation)
+{
+	yulAssert(_object.code, "");
+	yulAssert(_object.debugData, "");
+
+	// Apart from the code, the optimiser only depends on the names of the data
+	// accessible from it. The source names are needed to interpret the locations.
+	string description = _isCreation ? "creation\n" : "runtime\n";
+	for (YulString const& name: _object.qualifiedDataNames())
+		description += "data " + name.str() + "\n";
+	if (_object.debugData->sourceNames)
+		for (auto const& [index, sourceName]: *_object.debugData->sourceNames)
+			description += "source " + to_string(index) + " " + *sourceName + "\n";
+	description += AsmPrinter(
+		_dialect,
+		_object.debugData->sourceNames,
+		langutil::DebugInfoSelection::All()
+	)(*_object.code);
+	return keccak256(description);
+}
+
+unique_ptr<Block> OptimisedCodeCache::find(h256 const& _key) const
+{
+	shared_ptr<Block const> code;
+	{
+		lock_guard<mutex> lock(m_mutex);
+		auto it = m_code.find(_key);
+		if (it == m_code.end())
+			return nullptr;
+		code = it->second;
+		++m_hits;
+	}
+	return make_unique<Block>(std::get<Block>(ASTCopier{}(*code)));
+}
+
+void OptimisedCodeCache::store(h256 const& _key, Block const& _code)
+{
+	auto code = make_shared<Block const>(std::get<Block>(ASTCopier{}(_code)));
+	lock_guard<mutex> lock(m_mutex);
+	m_code.emplace(_key, move(code));
+}
+
+size_t OptimisedCodeCache::size() const
+{
+	lock_guard<mutex> lock(m_mutex);
+	return m_code.size();
+}
+
+size_t OptimisedCodeCache::hits() const
+{
+	lock_guard<mutex> lock(m_mutex);
+	return m_hits;
+}
@@ -0,0 +1,68 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for the results of optimising the code of Yul objects.
+ */
+#pragma once
+
+#include <libyul/ASTForward.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace solidity::yul
+{
+
+struct Dialect;
+struct Object;
+
+/**
+ * Stores the optimised code of Yul objects, keyed by their code before the optimisation
+ * and everything else the optimiser suite takes into account for an object.
+ *
+ * Lets objects that are embedded several times, e.g. a contract deployed by several
+ * factories, be optimised only once. A cache must only be used with a single dialect and
+ * set of optimiser settings. It can be shared between threads.
+ */
+class OptimisedCodeCache
+{
+public:
+	/// @returns the key for the code of @a _object (but not its sub-objects) in the state
+	/// before the optimisation.
+	static util::h256 key(Dialect const& _dialect, Object const& _object, bool _isCreation);
+
+	/// @returns a copy of the optimised code stored for @a _key or nullptr if there is none.
+	std::unique_ptr<Block> find(util::h256 const& _key) const;
+	/// Stores a copy of the optimised code @a _code for @a _key.
+	void store(util::h256 const& _key, Block const& _code);
+
+	/// @returns the number of objects whose optimised code is stored.
+	size_t size() const;
+	/// @returns the number of calls to find() that returned stored code.
+	size_t hits() const;
+
+private:
+	mutable std::mutex m_mutex;
+	std::map<util::h256, std::shared_ptr<Block const>> m_code;
+	mutable size_t m_hits = 0;
+};
+
+}
@@ -23,6 +23,8 @@
 #include <optional>
 #include <string>
 #include <set>
+#include <type_traits>
+#include <utility>
 
 namespace solidity::yul
 {
@@ -51,7 +53,17 @@ struct OptimiserStep
 	explicit OptimiserStep(std::string _name): name(std::move(_name)) {}
 	virtual ~OptimiserStep() = default;
 
-	virtual void run(OptimiserStepContext&, Block&) const = 0;
+	/// Runs the step.
+	/// @returns false if the step reports changes (see reportsChanges) and did not change the code.
+	virtual bool run(OptimiserStepContext&, Block&) const = 0;
+	/// Runs the step using at most @a _parallelism threads. The result is the same as that of run().
+	/// Only steps that transform the functions independently of each other actually use more than
+	/// one thread, they provide a static runInParallel method.
+	virtual bool runInParallel(OptimiserStepContext&, Block&, size_t _parallelism) const = 0;
+	/// @returns true if the return value of run() and runInParallel() tells whether the code changed.
+	/// Steps report changes by returning bool from their static run method. For all other steps,
+	/// the return value is always true.
+	virtual bool reportsChanges() const = 0;
 	/// @returns non-nullopt if the step cannot be run, for example because it requires
 	/// an SMT solver to be loaded, but none is available. In that case, the string
 	/// contains a human-readable reason.
@@ -74,11 +86,64 @@ private:
 		static constexpr bool value = decltype(test<T>(0))::value;
 	};
 
+	template<typename T>
+	struct RunReportsChanges
+	{
+		static constexpr bool value = std::is_same_v<
+			decltype(T::run(std::declval<OptimiserStepContext&>(), std::declval<Block&>())),
+			bool
+		>;
+	};
+
+	template<typename T>
+	struct HasRunInParallelMethod
+	{
+	private:
+		template<typename U> static auto test(int) -> decltype(
+			U::runInParallel(std::declval<OptimiserStepContext&>(), std::declval<Block&>(), size_t{}),
+			std::true_type()
+		);
+		template<typename> static std::false_type test(...);
+
+	public:
+		static constexpr bool value = decltype(test<T>(0))::value;
+	};
+
 public:
 	OptimiserStepInstance(): OptimiserStep{Step::name} {}
-	void run(OptimiserStepContext& _context, Block& _ast) const override
+	bool run(OptimiserStepContext& _context, Block& _ast) const override
+	{
+		if constexpr (RunReportsChanges<Step>::value)
+			return Step::run(_context, _ast);
+		else
+		{
+			Step::run(_context, _ast);
+			return true;
+		}
+	}
+	bool runInParallel(OptimiserStepContext& _context, Block& _ast, size_t _parallelism) const override
+	{
+		if constexpr (HasRunInParallelMethod<Step>::value)
+		{
+			static_assert(
+				RunReportsChanges<Step>::value ==
+				std::is_same_v<decltype(Step::runInParallel(_context, _ast, _parallelism)), bool>,
+				"run and runInParallel have to agree on reporting changes."
+			);
+			if constexpr (RunReportsChanges<Step>::value)
+				return Step::runInParallel(_context, _ast, _parallelism);
+			else
+			{
+				Step::runInParallel(_context, _ast, _parallelism);
+				return true;
+			}
+		}
+		else
+			return run(_context, _ast);
+	}
+	bool reportsChanges() const override
 	{
-		Step::run(_context, _ast);
+		return RunReportsChanges<Step>::value;
 	}
 	std::optional<std::string> invalidInCurrentEnvironment() const override
 	{
@@ -21,16 +21,21 @@
 
 #include <libyul/optimiser/OptimizerUtilities.h>
 
+#include <libyul/optimiser/ASTWalker.h>
 #include <libyul/backends/evm/EVMDialect.h>
 
 #include <libyul/Dialect.h>
 #include <libyul/AST.h>
+#include <libyul/Exceptions.h>
 
 #include <liblangutil/Token.h>
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Parallel.h>
 
 #include <range/v3/action/remove_if.hpp>
 
+#include <algorithm>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::langutil;
@@ -57,3 +62,45 @@ optional<evmasm::Instruction> yul::toEVMInstruction(Dialect const& _dialect, Yul
 			return builtin->instruction;
 	return nullopt;
 }
+
+bool yul::visitFunctionsInParallel(
+	Block& _ast,
+	size_t _parallelism,
+	function<unique_ptr<ASTModifier>()> const& _createVisitor,
+	function<bool(ASTModifier const&)> const& _changed
+)
+{
+	Block topLevelCode{_ast.debugData, {}};
+	vector<size_t> topLevelCodeIndices;
+	vector<FunctionDefinition*> functions;
+	for (size_t i = 0; i < _ast.statements.size(); ++i)
+		if (auto* function = get_if<FunctionDefinition>(&_ast.statements[i]))
+			functions.push_back(function);
+		else
+		{
+			topLevelCodeIndices.push_back(i);
+			topLevelCode.statements.emplace_back(move(_ast.statements[i]));
+		}
+	ScopeGuard restoreTopLevelCode([&]() {
+		yulAssert(topLevelCode.statements.size() == topLevelCodeIndices.size(), "");
+		for (size_t i = 0; i < topLevelCodeIndices.size(); ++i)
+			_ast.statements[topLevelCodeIndices[i]] = move(topLevelCode.statements[i]);
+	});
+
+	// Unit zero is the top-level code, the others are the functions in order.
+	// Using more chunks than threads evens out differences in the sizes of the functions.
+	size_t unitCount = functions.size() + 1;
+	size_t chunkCount = min(unitCount, _parallelism * 4);
+	// Not a vector<bool>, because the chunks set their flags concurrently.
+	vector<uint8_t> chunkChanged(chunkCount, 0);
+	parallelFor(chunkCount, _parallelism, [&](size_t _chunk) {
+		unique_ptr<ASTModifier> visitor = _createVisitor();
+		for (size_t unit = _chunk * unitCount / chunkCount; unit < (_chunk + 1) * unitCount / chunkCount; ++unit)
+			if (unit == 0)
+				(*visitor)(topLevelCode);
+			else
+				(*visitor)(*functions[unit - 1]);
+		chunkChanged[_chunk] = _changed(*visitor) ? 1 : 0;
+	});
+	return find(chunkChanged.begin(), chunkChanged.end(), 1) != chunkChanged.end();
+}
@@ -26,6 +26,8 @@
 #include <libyul/Dialect.h>
 #include <libyul/YulString.h>
 
+#include <functional>
+#include <memory>
 #include <optional>
 
 namespace solidity::evmasm
@@ -36,6 +38,8 @@ enum class Instruction: uint8_t;
 namespace solidity::yul
 {
 
+class ASTModifier;
+
 /// Removes statements that are just empty blocks (non-recursive).
 void removeEmptyBlocks(Block& _block);
 
@@ -46,4 +50,19 @@ bool isRestrictedIdentifier(Dialect const& _dialect, YulString const& _identifie
 /// Helper function that returns the instruction, if the `_name` is a BuiltinFunction
 std::optional<evmasm::Instruction> toEVMInstruction(Dialect const& _dialect, YulString const& _name);
 
+/// Applies visitors created by @a _createVisitor to the function definitions at the top level
+/// of @a _ast and to the remaining top-level statements, using at most @a _parallelism threads.
+/// The remaining statements are combined into a single block while they are visited.
+/// Each visitor handles a contiguous range of functions in order.
+/// The result is the same as visiting the whole AST with a single visitor, as long as the visitor
+/// treats each function definition independently of the code around it (like the DataFlowAnalyzer)
+/// and does not add or remove top-level statements.
+/// @returns true if @a _changed returns true for any of the visitors after it has been applied.
+bool visitFunctionsInParallel(
+	Block& _ast,
+	size_t _parallelism,
+	std::function<std::unique_ptr<ASTModifier>()> const& _createVisitor,
+	std::function<bool(ASTModifier const&)> const& _changed
+);
+
 }
@@ -24,6 +24,7 @@
 #include <libyul/optimiser/Disambiguator.h>
 #include <libyul/optimiser/VarDeclInitializer.h>
 #include <libyul/optimiser/BlockFlattener.h>
+#include <libyul/optimiser/BlockHasher.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/CircularReferencesPruner.h>
 #include <libyul/optimiser/ControlFlowSimplifier.h>
@@ -72,6 +73,7 @@
 #include <libyul/backends/evm/NoOutputAssembly.h>
 
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Profiler.h>
 
 #include <libyul/CompilabilityChecker.h>
 
@@ -92,7 +94,9 @@ void OptimiserSuite::run(
 	bool _optimizeStackAllocation,
 	string_view _optimisationSequence,
 	optional<size_t> _expectedExecutionsPerDeployment,
-	set<YulString> const& _externallyUsedIdentifiers
+	set<YulString> const& _externallyUsedIdentifiers,
+	size_t _parallelism,
+	bool _skipStableSteps
 )
 {
 	EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&_dialect);
@@ -114,7 +118,7 @@ void OptimiserSuite::run(
 	NameDispenser dispenser{_dialect, ast, reservedIdentifiers};
 	OptimiserStepContext context{_dialect, dispenser, reservedIdentifiers, _expectedExecutionsPerDeployment};
 
-	OptimiserSuite suite(context, Debug::None);
+	OptimiserSuite suite(context, Debug::None, _parallelism, _skipStableSteps);
 
 	// Some steps depend on properties ensured by FunctionHoister, BlockFlattener, FunctionGrouper and
 	// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
@@ -194,41 +198,39 @@ map<string, unique_ptr<OptimiserStep>> optimiserStepCollection()
 
 map<string, unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
 {
-	static map<string, unique_ptr<OptimiserStep>> instance;
-	if (instance.empty())
-		instance = optimiserStepCollection<
-			BlockFlattener,
-			CircularReferencesPruner,
-			CommonSubexpressionEliminator,
-			ConditionalSimplifier,
-			ConditionalUnsimplifier,
-			ControlFlowSimplifier,
-			DeadCodeEliminator,
-			EquivalentFunctionCombiner,
-			ExpressionInliner,
-			ExpressionJoiner,
-			ExpressionSimplifier,
-			ExpressionSplitter,
-			ForLoopConditionIntoBody,
-			ForLoopConditionOutOfBody,
-			ForLoopInitRewriter,
-			FullInliner,
-			FunctionGrouper,
-			FunctionHoister,
-			FunctionSpecializer,
-			LiteralRematerialiser,
-			LoadResolver,
-			LoopInvariantCodeMotion,
-			RedundantAssignEliminator,
-			ReasoningBasedSimplifier,
-			Rematerialiser,
-			SSAReverser,
-			SSATransform,
-			StructuralSimplifier,
-			UnusedFunctionParameterPruner,
-			UnusedPruner,
-			VarDeclInitializer
-		>();
+	static map<string, unique_ptr<OptimiserStep>> const instance = optimiserStepCollection<
+		BlockFlattener,
+		CircularReferencesPruner,
+		CommonSubexpressionEliminator,
+		ConditionalSimplifier,
+		ConditionalUnsimplifier,
+		ControlFlowSimplifier,
+		DeadCodeEliminator,
+		EquivalentFunctionCombiner,
+		ExpressionInliner,
+		ExpressionJoiner,
+		ExpressionSimplifier,
+		ExpressionSplitter,
+		ForLoopConditionIntoBody,
+		ForLoopConditionOutOfBody,
+		ForLoopInitRewriter,
+		FullInliner,
+		FunctionGrouper,
+		FunctionHoister,
+		FunctionSpecializer,
+		LiteralRematerialiser,
+		LoadResolver,
+		LoopInvariantCodeMotion,
+		RedundantAssignEliminator,
+		ReasoningBasedSimplifier,
+		Rematerialiser,
+		SSAReverser,
+		SSATransform,
+		StructuralSimplifier,
+		UnusedFunctionParameterPruner,
+		UnusedPruner,
+		VarDeclInitializer
+	>();
 	// Does not include VarNameCleaner because it destroys the property of unique names.
 	// Does not include NameSimplifier.
 	return instance;
@@ -329,7 +331,19 @@ void OptimiserSuite::validateSequence(string_view _stepAbbreviations)
 void OptimiserSuite::runSequence(string_view _stepAbbreviations, Block& _ast, bool _repeatUntilStable)
 {
 	validateSequence(_stepAbbreviations);
+	// The code might have been modified outside of the suite.
+	++m_codeVersion;
+	runValidatedSequence(_stepAbbreviations, _ast, _repeatUntilStable);
+}
+
+void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
+{
+	++m_codeVersion;
+	runSteps(_steps, _ast);
+}
 
+void OptimiserSuite::runValidatedSequence(string_view _stepAbbreviations, Block& _ast, bool _repeatUntilStable)
+{
 	// This splits 'aaa[bbb]ccc...' into 'aaa' and '[bbb]ccc...'.
 	auto extractNonNestedPrefix = [](string_view _tail) -> tuple<string_view, string_view>
 	{
@@ -399,17 +413,22 @@ void OptimiserSuite::runSequence(string_view _stepAbbreviations, Block& _ast, bo
 	size_t codeSize = 0;
 	for (size_t round = 0; round < MaxRounds; ++round)
 	{
+		size_t codeVersionBeforeRound = m_codeVersion;
 		for (auto const& [subsequence, repeat]: subsequences)
 		{
 			if (repeat)
-				runSequence(subsequence, _ast, true);
+				runValidatedSequence(subsequence, _ast, true);
 			else
-				runSequence(abbreviationsToSteps(subsequence), _ast);
+				runSteps(abbreviationsToSteps(subsequence), _ast);
 		}
 
 		if (!_repeatUntilStable)
 			break;
 
+		// Another round on unchanged code would not change it either.
+		if (m_skipStableSteps && m_codeVersion == codeVersionBeforeRound)
+			break;
+
 		size_t newSize = CodeSize::codeSizeIncludingFunctions(_ast);
 		if (newSize == codeSize)
 			break;
@@ -417,16 +436,54 @@ void OptimiserSuite::runSequence(string_view _stepAbbreviations, Block& _ast, bo
 	}
 }
 
-void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
+void OptimiserSuite::runSteps(std::vector<string> const& _steps, Block& _ast)
 {
 	unique_ptr<Block> copy;
 	if (m_debug == Debug::PrintChanges)
 		copy = make_unique<Block>(std::get<Block>(ASTCopier{}(_ast)));
 	for (string const& step: _steps)
 	{
+		// Steps are deterministic, so a step that did not change the code
+		// will not change it when run on the same code again.
+		if (
+			auto stable = m_stableSteps.find(step);
+			m_skipStableSteps && stable != m_stableSteps.end() && stable->second == m_codeVersion
+		)
+			continue;
+
+		OptimiserStep const& optimiserStep = *allSteps().at(step);
+		// Most steps report whether they changed the code. For the others,
+		// the code is hashed before and after they run.
+		bool hashCode = m_skipStableSteps && !optimiserStep.reportsChanges();
+		if (hashCode && m_hashedCodeVersion != m_codeVersion)
+		{
+			m_astHash = ASTHasher::run(_ast);
+			m_hashedCodeVersion = m_codeVersion;
+		}
+
 		if (m_debug == Debug::PrintStep)
 			cout << "Running " << step << endl;
-		allSteps().at(step)->run(m_context, _ast);
+		bool changed = true;
+		{
+			// The abbreviation is stored in a static map, so the view stays valid.
+			util::ProfilerScope profilerScope("yulOptimiserStep", string_view(&stepNameToAbbreviationMap().at(step), 1));
+			if (m_parallelism > 1)
+				changed = optimiserStep.runInParallel(m_context, _ast, m_parallelism);
+			else
+				changed = optimiserStep.run(m_context, _ast);
+		}
+		if (hashCode)
+		{
+			uint64_t astHashBeforeStep = m_astHash;
+			m_astHash = ASTHasher::run(_ast);
+			changed = m_astHash != astHashBeforeStep;
+		}
+		if (changed)
+			++m_codeVersion;
+		else
+			m_stableSteps[step] = m_codeVersion;
+		if (hashCode)
+			m_hashedCodeVersion = m_codeVersion;
 		if (m_debug == Debug::PrintChanges)
 		{
 			// TODO should add switch to also compare variable names!
@@ -59,7 +59,18 @@ public:
 		PrintStep,
 		PrintChanges
 	};
-	OptimiserSuite(OptimiserStepContext& _context, Debug _debug = Debug::None): m_context(_context), m_debug(_debug) {}
+	/// @param _parallelism maximum number of threads used by steps that can optimise
+	/// the functions of the code concurrently.
+	/// @param _skipStableSteps if true, steps that already ran on the current code without
+	/// changing it are not run again. This does not affect the result.
+	OptimiserSuite(
+		OptimiserStepContext& _context,
+		Debug _debug = Debug::None,
+		size_t _parallelism = 1,
+		bool _skipStableSteps = true
+	):
+		m_context(_context), m_debug(_debug), m_parallelism(_parallelism), m_skipStableSteps(_skipStableSteps)
+	{}
 
 	/// The value nullopt for `_expectedExecutionsPerDeployment` represents creation code.
 	static void run(
@@ -69,7 +80,9 @@ public:
 		bool _optimizeStackAllocation,
 		std::string_view _optimisationSequence,
 		std::optional<size_t> _expectedExecutionsPerDeployment,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		size_t _parallelism = 1,
+		bool _skipStableSteps = true
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
@@ -84,8 +97,22 @@ public:
 	static std::map<char, std::string> const& stepAbbreviationToNameMap();
 
 private:
+	void runValidatedSequence(std::string_view _stepAbbreviations, Block& _ast, bool _repeatUntilStable);
+	/// Runs the given steps, skipping those that already ran on the current code without changing it.
+	void runSteps(std::vector<std::string> const& _steps, Block& _ast);
+
 	OptimiserStepContext& m_context;
 	Debug m_debug;
+	size_t m_parallelism = 1;
+	bool m_skipStableSteps = true;
+	/// Version of the code being optimised, incremented whenever it may have changed.
+	size_t m_codeVersion = 0;
+	/// Hash of the code as computed by ASTHasher and the version it was computed for.
+	/// Only needed to find out whether steps that do not report changes changed the code.
+	uint64_t m_astHash = 0;
+	std::optional<size_t> m_hashedCodeVersion;
+	/// Version of the code on which a step last ran without changing it, for each step.
+	std::map<std::string, size_t> m_stableSteps;
 };
 
 }
@@ -73,6 +73,7 @@ void UnusedPruner::operator()(Block& _block)
 			{
 				subtractReferences(ReferencesCounter::countReferences(funDef.body));
 				statement = Block{std::move(funDef.debugData), {}};
+				m_changed = true;
 			}
 		}
 		else if (holds_alternative<VariableDeclaration>(statement))
@@ -90,7 +91,10 @@ void UnusedPruner::operator()(Block& _block)
 			))
 			{
 				if (!varDecl.value)
+				{
 					statement = Block{std::move(varDecl.debugData), {}};
+					m_changed = true;
+				}
 				else if (
 					SideEffectsCollector(m_dialect, *varDecl.value, m_functionSideEffects).
 					canBeRemoved(m_allowMSizeOptimization)
@@ -98,13 +102,17 @@ void UnusedPruner::operator()(Block& _block)
 				{
 					subtractReferences(ReferencesCounter::countReferences(*varDecl.value));
 					statement = Block{std::move(varDecl.debugData), {}};
+					m_changed = true;
 				}
 				else if (varDecl.variables.size() == 1 && m_dialect.discardFunction(varDecl.variables.front().type))
+				{
 					statement = ExpressionStatement{varDecl.debugData, FunctionCall{
 						varDecl.debugData,
 						{varDecl.debugData, m_dialect.discardFunction(varDecl.variables.front().type)->name},
 						{*std::move(varDecl.value)}
 					}};
+					m_changed = true;
+				}
 			}
 		}
 		else if (holds_alternative<ExpressionStatement>(statement))
@@ -117,15 +125,19 @@ void UnusedPruner::operator()(Block& _block)
 			{
 				subtractReferences(ReferencesCounter::countReferences(exprStmt.expression));
 				statement = Block{std::move(exprStmt.debugData), {}};
+				m_changed = true;
 			}
 		}
 
+	size_t statementCount = _block.statements.size();
 	removeEmptyBlocks(_block);
+	if (_block.statements.size() != statementCount)
+		m_changed = true;
 
 	ASTModifier::operator()(_block);
 }
 
-void UnusedPruner::runUntilStabilised(
+bool UnusedPruner::runUntilStabilised(
 	Dialect const& _dialect,
 	Block& _ast,
 	bool _allowMSizeOptimization,
@@ -133,18 +145,20 @@ void UnusedPruner::runUntilStabilised(
 	set<YulString> const& _externallyUsedFunctions
 )
 {
+	bool changed = false;
 	while (true)
 	{
 		UnusedPruner pruner(
 			_dialect, _ast, _allowMSizeOptimization, _functionSideEffects,
 							_externallyUsedFunctions);
 		pruner(_ast);
+		changed = changed || pruner.m_changed;
 		if (!pruner.shouldRunAgain())
-			return;
+			return changed;
 	}
 }
 
-void UnusedPruner::runUntilStabilisedOnFullAST(
+bool UnusedPruner::runUntilStabilisedOnFullAST(
 	Dialect const& _dialect,
 	Block& _ast,
 	set<YulString> const& _externallyUsedFunctions
@@ -153,22 +167,24 @@ void UnusedPruner::runUntilStabilisedOnFullAST(
 	map<YulString, SideEffects> functionSideEffects =
 		SideEffectsPropagator::sideEffects(_dialect, CallGraphGenerator::callGraph(_ast));
 	bool allowMSizeOptimization = !MSizeFinder::containsMSize(_dialect, _ast);
-	runUntilStabilised(_dialect, _ast, allowMSizeOptimization, &functionSideEffects, _externallyUsedFunctions);
+	return runUntilStabilised(_dialect, _ast, allowMSizeOptimization, &functionSideEffects, _externallyUsedFunctions);
 }
 
-void UnusedPruner::runUntilStabilised(
+bool UnusedPruner::runUntilStabilised(
 	Dialect const& _dialect,
 	FunctionDefinition& _function,
 	bool _allowMSizeOptimization,
 	set<YulString> const& _externallyUsedFunctions
 )
 {
+	bool changed = false;
 	while (true)
 	{
 		UnusedPruner pruner(_dialect, _function, _allowMSizeOptimization, _externallyUsedFunctions);
 		pruner(_function);
+		changed = changed || pruner.m_changed;
 		if (!pruner.shouldRunAgain())
-			return;
+			return changed;
 	}
 }
 
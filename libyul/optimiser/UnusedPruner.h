@@ -50,8 +50,9 @@ class UnusedPruner: public ASTModifier
 {
 public:
 	static constexpr char const* name{"UnusedPruner"};
-	static void run(OptimiserStepContext& _context, Block& _ast) {
-		UnusedPruner::runUntilStabilisedOnFullAST(_context.dialect, _ast, _context.reservedIdentifiers);
+	/// @returns true if the code was changed.
+	static bool run(OptimiserStepContext& _context, Block& _ast) {
+		return UnusedPruner::runUntilStabilisedOnFullAST(_context.dialect, _ast, _context.reservedIdentifiers);
 	}
 
 
@@ -62,7 +63,8 @@ public:
 	bool shouldRunAgain() const { return m_shouldRunAgain; }
 
 	// Run the pruner until the code does not change anymore.
-	static void runUntilStabilised(
+	// @returns true if the code was changed.
+	static bool runUntilStabilised(
 		Dialect const& _dialect,
 		Block& _ast,
 		bool _allowMSizeOptimization,
@@ -83,7 +85,8 @@ public:
 	/// The provided block has to be a full AST.
 	/// The pruner itself determines if msize is used and which user-defined functions
 	/// are side-effect free.
-	static void runUntilStabilisedOnFullAST(
+	/// @returns true if the code was changed.
+	static bool runUntilStabilisedOnFullAST(
 		Dialect const& _dialect,
 		Block& _ast,
 		std::set<YulString> const& _externallyUsedFunctions = {}
@@ -94,7 +97,8 @@ public:
 	// @param _allowMSizeOptimization if true, allows to remove instructions
 	//        whose only side-effect is a potential change of the return value of
 	//        the msize instruction.
-	static void runUntilStabilised(
+	// @returns true if the code was changed.
+	static bool runUntilStabilised(
 		Dialect const& _dialect,
 		FunctionDefinition& _functionDefinition,
 		bool _allowMSizeOptimization,
@@ -123,6 +127,7 @@ private:
 	bool m_allowMSizeOptimization = false;
 	std::map<YulString, SideEffects> const* m_functionSideEffects = nullptr;
 	bool m_shouldRunAgain = false;
+	bool m_changed = false;
 	std::map<YulString, size_t> m_references;
 };
 
@@ -39,6 +39,7 @@ void VarDeclInitializer::operator()(Block& _block)
 			if (_varDecl.value)
 				return {};
 
+			m_changed = true;
 			if (_varDecl.variables.size() == 1)
 			{
 				_varDecl.value = make_unique<Expression>(m_dialect.zeroLiteralForType(_varDecl.variables.front().type));
@@ -35,7 +35,13 @@ class VarDeclInitializer: public ASTModifier
 {
 public:
 	static constexpr char const* name{"VarDeclInitializer"};
-	static void run(OptimiserStepContext& _ctx, Block& _ast) { VarDeclInitializer{_ctx.dialect}(_ast); }
+	/// @returns true if a variable declaration was initialized.
+	static bool run(OptimiserStepContext& _ctx, Block& _ast)
+	{
+		VarDeclInitializer initializer{_ctx.dialect};
+		initializer(_ast);
+		return initializer.m_changed;
+	}
 
 	void operator()(Block& _block) override;
 
@@ -43,6 +49,7 @@ private:
 	explicit VarDeclInitializer(Dialect const& _dialect): m_dialect(_dialect) {}
 
 	Dialect const& m_dialect;
+	bool m_changed = false;
 };
 
 }
@@ -0,0 +1,68 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Replacements of the global allocation functions that count the allocations of each thread
+ * for the --time-report and settings.profile outputs. Counting only increments a thread-local
+ * variable. The other forms of operator new and delete forward to these.
+ * They are kept apart from the rest of solc, so that GCC does not inline them into standard
+ * library code and then report mismatched allocation functions.
+ */
+
+#include <libsolutil/Profiler.h>
+
+#include <cstdlib>
+#include <new>
+
+void* operator new(std::size_t _size)
+{
+	solidity::util::countAllocation();
+	while (true)
+	{
+		if (void* memory = std::malloc(_size == 0 ? 1 : _size))
+			return memory;
+		if (std::new_handler handler = std::get_new_handler())
+			handler();
+		else
+			throw std::bad_alloc();
+	}
+}
+
+void* operator new[](std::size_t _size)
+{
+	return operator new(_size);
+}
+
+void operator delete(void* _memory) noexcept
+{
+	std::free(_memory);
+}
+
+void operator delete[](void* _memory) noexcept
+{
+	operator delete(_memory);
+}
+
+void operator delete(void* _memory, std::size_t) noexcept
+{
+	operator delete(_memory);
+}
+
+void operator delete[](void* _memory, std::size_t) noexcept
+{
+	operator delete(_memory);
+}
@@ -38,6 +38,7 @@
 #include <libsolidity/interface/StorageLayout.h>
 
 #include <libyul/AssemblyStack.h>
+#include <libyul/YulString.h>
 
 #include <libevmasm/Instruction.h>
 #include <libevmasm/GasMeter.h>
@@ -52,6 +53,7 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/SharedText.h>
 
 #include <algorithm>
 #include <memory>
@@ -360,6 +362,20 @@ void CommandLineInterface::handleNatspec(bool _natspecDev, string const& _contra
 	}
 }
 
+void CommandLineInterface::handleTimeReport()
+{
+	solAssert(m_options.input.mode == InputMode::Compiler || m_options.input.mode == InputMode::CompilerWithASTImport, "");
+
+	if (!m_options.compiler.timeReport)
+		return;
+
+	string data = jsonPrettyPrint(m_compiler->profile());
+	if (!m_options.output.dir.empty())
+		createFile("time-report.json", data);
+	else
+		sout() << endl << "======= Time report =======" << endl << data << endl;
+}
+
 void CommandLineInterface::handleGasEstimation(string const& _contract)
 {
 	solAssert(m_options.input.mode == InputMode::Compiler || m_options.input.mode == InputMode::CompilerWithASTImport, "");
@@ -483,15 +499,14 @@ bool CommandLineInterface::readInputFiles()
 		}
 
 		// NOTE: we ignore the FileNotFound exception as we manually check above
-		string fileContent = readFileAsString(infile);
 		if (m_options.input.mode == InputMode::StandardJson)
 		{
 			solAssert(!m_standardJsonInput.has_value(), "");
-			m_standardJsonInput = move(fileContent);
+			m_standardJsonInput = readFileAsString(infile);
 		}
 		else
 		{
-			m_fileReader.setSource(infile, move(fileContent));
+			m_fileReader.setSource(infile, util::SharedText::fromFile(infile));
 			m_fileReader.allowDirectory(boost::filesystem::canonical(infile).remove_filename());
 		}
 	}
@@ -507,7 +522,7 @@ bool CommandLineInterface::readInputFiles()
 			m_fileReader.setStdin(readUntilEnd(m_sin));
 	}
 
-	if (m_fileReader.sourceCodes().empty() && !m_standardJsonInput.has_value())
+	if (m_fileReader.sharedSourceCodes().empty() && !m_standardJsonInput.has_value())
 	{
 		serr() << "All specified input files either do not exist or are not regular files." << endl;
 		return false;
@@ -523,10 +538,10 @@ map<string, Json::Value> CommandLineInterface::parseAstFromInput()
 	map<string, Json::Value> sourceJsons;
 	map<string, string> tmpSources;
 
-	for (SourceCode const& sourceCode: m_fileReader.sourceCodes() | ranges::views::values)
+	for (util::SharedTextPointer const& sourceCode: m_fileReader.sharedSourceCodes() | ranges::views::values)
 	{
 		Json::Value ast;
-		astAssert(jsonParseStrict(sourceCode, ast), "Input file could not be parsed to JSON");
+		astAssert(jsonParseStrict(string(sourceCode->view()), ast), "Input file could not be parsed to JSON");
 		astAssert(ast.isMember("sources"), "Invalid Format for import-JSON: Must have 'sources'-object");
 
 		for (auto& src: ast["sources"].getMemberNames())
@@ -603,6 +618,11 @@ bool CommandLineInterface::parseArguments(int _argc, char const* const* _argv)
 
 bool CommandLineInterface::processInput()
 {
+	// Yul strings are released once the results have been printed and the compiler
+	// that refers to them is gone, which matters when the interface is used in-process.
+	yul::YulStringRepository::Session yulStringSession;
+	ScopeGuard releaseCompiler([&]() { m_compiler.reset(); });
+
 	switch (m_options.input.mode)
 	{
 	case InputMode::Help:
@@ -619,6 +639,8 @@ bool CommandLineInterface::processInput()
 		solAssert(m_standardJsonInput.has_value(), "");
 
 		StandardCompiler compiler(m_fileReader.reader(), m_options.formatting.json);
+		if (!m_options.input.cacheDirectory.empty())
+			compiler.setCacheDirectory(m_options.input.cacheDirectory);
 		sout() << compiler.compile(move(m_standardJsonInput.value())) << endl;
 		m_standardJsonInput.reset();
 		break;
@@ -677,6 +699,8 @@ bool CommandLineInterface::compile()
 		m_compiler->setRevertStringBehaviour(m_options.output.revertStrings);
 		if (m_options.output.debugInfoSelection.has_value())
 			m_compiler->selectDebugInfo(m_options.output.debugInfoSelection.value());
+		m_compiler->setParallelism(m_options.output.jobs);
+		m_compiler->enableProfiling(m_options.compiler.timeReport);
 		// TODO: Perhaps we should not compile unless requested
 
 		m_compiler->enableIRGeneration(m_options.compiler.outputs.ir || m_options.compiler.outputs.irOptimized);
@@ -724,7 +748,7 @@ bool CommandLineInterface::compile()
 		}
 		else
 		{
-			m_compiler->setSources(m_fileReader.sourceCodes());
+			m_compiler->setSources(m_fileReader.sharedSourceCodes());
 			m_compiler->setParserErrorRecovery(m_options.input.errorRecovery);
 		}
 
@@ -838,7 +862,7 @@ void CommandLineInterface::handleCombinedJSON()
 	if (m_options.compiler.combinedJsonRequests->ast)
 	{
 		output[g_strSources] = Json::Value(Json::objectValue);
-		for (auto const& sourceCode: m_fileReader.sourceCodes())
+		for (auto const& sourceCode: m_fileReader.sharedSourceCodes())
 		{
 			ASTJsonConverter converter(m_compiler->state(), m_compiler->sourceIndices());
 			output[g_strSources][sourceCode.first] = Json::Value(Json::objectValue);
@@ -861,12 +885,12 @@ void CommandLineInterface::handleAst()
 		return;
 
 	vector<ASTNode const*> asts;
-	for (auto const& sourceCode: m_fileReader.sourceCodes())
+	for (auto const& sourceCode: m_fileReader.sharedSourceCodes())
 		asts.push_back(&m_compiler->ast(sourceCode.first));
 
 	if (!m_options.output.dir.empty())
 	{
-		for (auto const& sourceCode: m_fileReader.sourceCodes())
+		for (auto const& sourceCode: m_fileReader.sharedSourceCodes())
 		{
 			stringstream data;
 			string postfix = "";
@@ -879,7 +903,7 @@ void CommandLineInterface::handleAst()
 	else
 	{
 		sout() << "JSON AST (compact format):" << endl << endl;
-		for (auto const& sourceCode: m_fileReader.sourceCodes())
+		for (auto const& sourceCode: m_fileReader.sharedSourceCodes())
 		{
 			sout() << endl << "======= " << sourceCode.first << " =======" << endl;
 			ASTJsonConverter(m_compiler->state(), m_compiler->sourceIndices()).print(sout(), m_compiler->ast(sourceCode.first));
@@ -956,13 +980,13 @@ void CommandLineInterface::writeLinkedFiles()
 {
 	solAssert(m_options.input.mode == InputMode::Linker, "");
 
-	for (auto const& src: m_fileReader.sourceCodes())
+	for (auto const& src: m_fileReader.sharedSourceCodes())
 		if (src.first == g_stdinFileName)
-			sout() << src.second << endl;
+			sout() << src.second->view() << endl;
 		else
 		{
 			ofstream outFile(src.first);
-			outFile << src.second;
+			outFile << src.second->view();
 			if (!outFile)
 			{
 				serr() << "Could not write to file " << src.first << ". Aborting." << endl;
@@ -996,7 +1020,7 @@ bool CommandLineInterface::assemble(yul::AssemblyStack::Language _language, yul:
 
 	bool successful = true;
 	map<string, yul::AssemblyStack> assemblyStacks;
-	for (auto const& src: m_fileReader.sourceCodes())
+	for (auto const& src: m_fileReader.sharedSourceCodes())
 	{
 		// --no-optimize-yul option is not accepted in assembly mode.
 		solAssert(!m_options.optimizer.noOptimizeYul, "");
@@ -1010,7 +1034,7 @@ bool CommandLineInterface::assemble(yul::AssemblyStack::Language _language, yul:
 				DebugInfoSelection::Default()
 		);
 
-		if (!stack.parseAndAnalyze(src.first, src.second))
+		if (!stack.parseAndAnalyze(src.first, string(src.second->view())))
 			successful = false;
 		else
 			stack.optimize();
@@ -1033,7 +1057,7 @@ bool CommandLineInterface::assemble(yul::AssemblyStack::Language _language, yul:
 	if (!successful)
 		return false;
 
-	for (auto const& src: m_fileReader.sourceCodes())
+	for (auto const& src: m_fileReader.sharedSourceCodes())
 	{
 		string machine =
 			_targetMachine == yul::AssemblyStack::Machine::EVM ? "EVM" :
@@ -1108,9 +1132,15 @@ void CommandLineInterface::outputCompilationResults()
 	)
 	{
 		serr() << endl << "Compilation halted after AST generation due to errors." << endl;
+		handleTimeReport();
 		return;
 	}
 
+	// The source texts are only needed to annotate the EVM assembly.
+	FileReader::StringMap sourceCodes;
+	if (m_options.compiler.outputs.asm_ && !m_options.compiler.outputs.asmJson)
+		sourceCodes = m_fileReader.sourceCodes();
+
 	vector<string> contracts = m_compiler->contractNames();
 	for (string const& contract: contracts)
 	{
@@ -1124,7 +1154,7 @@ void CommandLineInterface::outputCompilationResults()
 			if (m_options.compiler.outputs.asmJson)
 				ret = jsonPrettyPrint(removeNullMembers(m_compiler->assemblyJSON(contract)));
 			else
-				ret = m_compiler->assemblyString(contract, m_fileReader.sourceCodes());
+				ret = m_compiler->assemblyString(contract, sourceCodes);
 
 			if (!m_options.output.dir.empty())
 			{
@@ -1151,6 +1181,8 @@ void CommandLineInterface::outputCompilationResults()
 		handleNatspec(false, contract);
 	} // end of contracts iteration
 
+	handleTimeReport();
+
 	if (!m_hasOutput)
 	{
 		if (!m_options.output.dir.empty())
@@ -19,6 +19,7 @@
 #include <solc/CommandLineParser.h>
 #include <libyul/optimiser/Suite.h>
 #include <liblangutil/EVMVersion.h>
+#include <libsolutil/Parallel.h>
 
 #include <boost/algorithm/string.hpp>
 
@@ -46,6 +47,7 @@ static string const g_strAllowPaths = "allow-paths";
 static string const g_strBasePath = "base-path";
 static string const g_strIncludePath = "include-path";
 static string const g_strAssemble = "assemble";
+static string const g_strCacheDir = "cache-dir";
 static string const g_strCombinedJson = "combined-json";
 static string const g_strErrorRecovery = "error-recovery";
 static string const g_strEVM = "evm";
@@ -56,6 +58,7 @@ static string const g_strGas = "gas";
 static string const g_strHelp = "help";
 static string const g_strImportAst = "import-ast";
 static string const g_strInputFile = "input-file";
+static string const g_strJobs = "jobs";
 static string const g_strYul = "yul";
 static string const g_strYulDialect = "yul-dialect";
 static string const g_strDebugInfo = "debug-info";
@@ -66,6 +69,7 @@ static string const g_strLink = "link";
 static string const g_strMachine = "machine";
 static string const g_strMetadataHash = "metadata-hash";
 static string const g_strMetadataLiteral = "metadata-literal";
+static string const g_strModelCheckerCacheDir = "model-checker-cache-dir";
 static string const g_strModelCheckerContracts = "model-checker-contracts";
 static string const g_strModelCheckerDivModNoSlacks = "model-checker-div-mod-no-slacks";
 static string const g_strModelCheckerEngine = "model-checker-engine";
@@ -73,6 +77,7 @@ static string const g_strModelCheckerInvariants = "model-checker-invariants";
 static string const g_strModelCheckerShowUnproved = "model-checker-show-unproved";
 static string const g_strModelCheckerSolvers = "model-checker-solvers";
 static string const g_strModelCheckerTargets = "model-checker-targets";
+static string const g_strModelCheckerTimeBudget = "model-checker-time-budget";
 static string const g_strModelCheckerTimeout = "model-checker-timeout";
 static string const g_strNone = "none";
 static string const g_strNoOptimizeYul = "no-optimize-yul";
@@ -84,6 +89,7 @@ static string const g_strOutputDir = "output-dir";
 static string const g_strOverwrite = "overwrite";
 static string const g_strRevertStrings = "revert-strings";
 static string const g_strStopAfter = "stop-after";
+static string const g_strTimeReport = "time-report";
 static string const g_strParsing = "parsing";
 
 /// Possible arguments to for --revert-strings
@@ -220,6 +226,7 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		input.allowedDirectories == _other.input.allowedDirectories &&
 		input.ignoreMissingFiles == _other.input.ignoreMissingFiles &&
 		input.errorRecovery == _other.input.errorRecovery &&
+		input.cacheDirectory == _other.input.cacheDirectory &&
 		output.dir == _other.output.dir &&
 		output.overwriteFiles == _other.output.overwriteFiles &&
 		output.evmVersion == _other.output.evmVersion &&
@@ -227,6 +234,7 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		output.revertStrings == _other.output.revertStrings &&
 		output.debugInfoSelection == _other.output.debugInfoSelection &&
 		output.stopAfter == _other.output.stopAfter &&
+		output.jobs == _other.output.jobs &&
 		input.mode == _other.input.mode &&
 		assembly.targetMachine == _other.assembly.targetMachine &&
 		assembly.inputLanguage == _other.assembly.inputLanguage &&
@@ -236,6 +244,7 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		formatting.withErrorIds == _other.formatting.withErrorIds &&
 		compiler.outputs == _other.compiler.outputs &&
 		compiler.estimateGas == _other.compiler.estimateGas &&
+		compiler.timeReport == _other.compiler.timeReport &&
 		compiler.combinedJsonRequests == _other.compiler.combinedJsonRequests &&
 		metadata.hash == _other.metadata.hash &&
 		metadata.literalSources == _other.metadata.literalSources &&
@@ -564,6 +573,13 @@ General Information)").c_str(),
 			g_strErrorRecovery.c_str(),
 			"Enables additional parser error recovery."
 		)
+		(
+			g_strCacheDir.c_str(),
+			po::value<string>()->value_name("path"),
+			("Store the outputs of compilations in the given directory and reuse them when the input, "
+			"the compiler version and all imported files are unchanged. "
+			"Can only be used together with --" + g_strStandardJSON + ".").c_str()
+		)
 	;
 	desc.add(inputOptions);
 
@@ -605,6 +621,13 @@ General Information)").c_str(),
 			po::value<string>()->value_name("stage"),
 			"Stop execution after the given compiler stage. Valid options: \"parsing\"."
 		)
+		(
+			g_strJobs.c_str(),
+			po::value<unsigned>()->value_name("n"),
+			"Use up to n threads to generate code for different contracts concurrently. "
+			"Currently the Yul optimizer, the translation of Yul to EVM assembly and the CHC engine of the model checker are run concurrently. "
+			"A value of 0 uses as many threads as the machine provides. The output does not depend on this setting."
+		)
 	;
 	desc.add(outputOptions);
 
@@ -727,6 +750,12 @@ General Information)").c_str(),
 			g_strGas.c_str(),
 			"Print an estimate of the maximal gas usage for each function."
 		)
+		(
+			g_strTimeReport.c_str(),
+			"Report the wall time and the heap allocations of the compiler phases, analysis passes, "
+			"code generation steps and Yul optimizer steps as JSON that can be loaded as a Chrome trace. "
+			"Written to time-report.json if an output directory is given."
+		)
 		(
 			g_strCombinedJson.c_str(),
 			po::value<string>()->value_name(joinHumanReadable(CombinedJsonRequests::componentMap() | ranges::views::keys, ",")),
@@ -781,6 +810,12 @@ General Information)").c_str(),
 
 	po::options_description smtCheckerOptions("Model Checker Options");
 	smtCheckerOptions.add_options()
+		(
+			g_strModelCheckerCacheDir.c_str(),
+			po::value<string>()->value_name("path"),
+			"Store the results of SMT queries in the given directory and reuse them "
+			"when the same query is made to the same solvers again."
+		)
 		(
 			g_strModelCheckerContracts.c_str(),
 			po::value<string>()->value_name("default,<source>:<contract>")->default_value("default"),
@@ -828,6 +863,13 @@ General Information)").c_str(),
 			"The default is a deterministic resource limit. "
 			"A timeout of 0 means no resource/time restrictions for any query."
 		)
+		(
+			g_strModelCheckerTimeBudget.c_str(),
+			po::value<unsigned>()->value_name("ms"),
+			"Set the total time in milliseconds after which the model checker does not start "
+			"any further queries. Targets that were not checked by then are reported as unproved. "
+			"Use --jobs to check independent targets of the CHC engine concurrently."
+		)
 	;
 	desc.add(smtCheckerOptions);
 
@@ -910,6 +952,9 @@ bool CommandLineParser::processArgs()
 		// TODO: This should eventually contain all options.
 		{g_strErrorRecovery, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strExperimentalViaIR, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strJobs, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strTimeReport, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strCacheDir, {InputMode::StandardJson}},
 	};
 	vector<string> invalidOptionsForCurrentInputMode;
 	for (auto const& [optionName, inputModes]: validOptionInputModeCombinations)
@@ -1032,6 +1077,7 @@ bool CommandLineParser::processArgs()
 		return false;
 
 	m_options.compiler.estimateGas = (m_args.count(g_strGas) > 0);
+	m_options.compiler.timeReport = (m_args.count(g_strTimeReport) > 0);
 
 	if (m_args.count(g_strBasePath))
 		m_options.input.basePath = m_args[g_strBasePath].as<string>();
@@ -1055,6 +1101,16 @@ bool CommandLineParser::processArgs()
 		}
 	}
 
+	if (m_args.count(g_strCacheDir))
+	{
+		if (m_args[g_strCacheDir].as<string>().empty())
+		{
+			serr() << "Empty values are not allowed in --" << g_strCacheDir << "." << endl;
+			return false;
+		}
+		m_options.input.cacheDirectory = m_args[g_strCacheDir].as<string>();
+	}
+
 	if (m_args.count(g_strAllowPaths))
 	{
 		vector<string> paths;
@@ -1235,6 +1291,16 @@ bool CommandLineParser::processArgs()
 		}
 	}
 
+	if (m_args.count(g_strModelCheckerCacheDir))
+	{
+		if (m_args[g_strModelCheckerCacheDir].as<string>().empty())
+		{
+			serr() << "Empty values are not allowed in --" << g_strModelCheckerCacheDir << "." << endl;
+			return false;
+		}
+		m_options.modelChecker.settings.cacheDirectory = m_args[g_strModelCheckerCacheDir].as<string>();
+	}
+
 	if (m_args.count(g_strModelCheckerContracts))
 	{
 		string contractsStr = m_args[g_strModelCheckerContracts].as<string>();
@@ -1304,8 +1370,12 @@ bool CommandLineParser::processArgs()
 	if (m_args.count(g_strModelCheckerTimeout))
 		m_options.modelChecker.settings.timeout = m_args[g_strModelCheckerTimeout].as<unsigned>();
 
+	if (m_args.count(g_strModelCheckerTimeBudget))
+		m_options.modelChecker.settings.timeBudget = m_args[g_strModelCheckerTimeBudget].as<unsigned>();
+
 	m_options.metadata.literalSources = (m_args.count(g_strMetadataLiteral) > 0);
 	m_options.modelChecker.initialize =
+		m_args.count(g_strModelCheckerCacheDir) ||
 		m_args.count(g_strModelCheckerContracts) ||
 		m_args.count(g_strModelCheckerDivModNoSlacks) ||
 		m_args.count(g_strModelCheckerEngine) ||
@@ -1313,8 +1383,14 @@ bool CommandLineParser::processArgs()
 		m_args.count(g_strModelCheckerShowUnproved) ||
 		m_args.count(g_strModelCheckerSolvers) ||
 		m_args.count(g_strModelCheckerTargets) ||
-		m_args.count(g_strModelCheckerTimeout);
+		m_args.count(g_strModelCheckerTimeout) ||
+		m_args.count(g_strModelCheckerTimeBudget);
 	m_options.output.experimentalViaIR = (m_args.count(g_strExperimentalViaIR) > 0);
+	if (m_args.count(g_strJobs))
+	{
+		unsigned jobs = m_args[g_strJobs].as<unsigned>();
+		m_options.output.jobs = (jobs == 0 ? util::defaultParallelism() : jobs);
+	}
 	if (m_options.input.mode == InputMode::Compiler)
 		m_options.input.errorRecovery = (m_args.count(g_strErrorRecovery) > 0);
 
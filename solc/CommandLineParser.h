@@ -174,6 +174,7 @@ struct CommandLineOptions
 		FileReader::FileSystemPathSet allowedDirectories;
 		bool ignoreMissingFiles = false;
 		bool errorRecovery = false;
+		boost::filesystem::path cacheDirectory;
 	} input;
 
 	struct
@@ -185,6 +186,7 @@ struct CommandLineOptions
 		RevertStrings revertStrings = RevertStrings::Default;
 		std::optional<langutil::DebugInfoSelection> debugInfoSelection;
 		CompilerStack::State stopAfter = CompilerStack::State::CompilationSuccessful;
+		size_t jobs = 1;
 	} output;
 
 	struct
@@ -209,6 +211,7 @@ struct CommandLineOptions
 	{
 		CompilerOutputs outputs;
 		bool estimateGas = false;
+		bool timeReport = false;
 		std::optional<CombinedJsonRequests> combinedJsonRequests;
 	} compiler;
 
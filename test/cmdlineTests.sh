@@ -512,6 +512,20 @@ SOLTMPDIR=$(mktemp -d)
 )
 rm -r "$SOLTMPDIR"
 
+printTask "Testing reuse of the model checker query cache..."
+SOLTMPDIR=$(mktemp -d)
+(
+    cd "$SOLTMPDIR"
+    echo 'contract C { function f(uint x, uint y) public pure { require(y > 0); assert(x / y <= x); assert(x > 2); } }' > x.sol
+    first=$(msg_on_error --no-stdout "$SOLC" x.sol --model-checker-engine all --model-checker-cache-dir cache 2>&1)
+    entries=$(find cache -name '*.smt' | wc -l)
+    [[ $entries -gt 0 ]] || fail "The model checker did not store any results in its query cache."
+    second=$(msg_on_error --no-stdout "$SOLC" x.sol --model-checker-engine all --model-checker-cache-dir cache 2>&1)
+    [[ "$first" == "$second" ]] || fail "The model checker reported different results when reusing its query cache:\n$first\n---\n$second"
+    [[ $(find cache -name '*.smt' | wc -l) -eq $entries ]] || fail "The model checker did not reuse all results in its query cache."
+)
+rm -r "$SOLTMPDIR"
+
 printTask "Testing assemble, yul, strict-assembly and optimize..."
 (
     echo '{}' | msg_on_error --silent "$SOLC" - --assemble
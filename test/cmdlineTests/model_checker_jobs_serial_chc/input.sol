@@ -0,0 +1,14 @@
+// SPDX-License-Identifier: GPL-3.0
+pragma solidity >=0.0;
+contract test {
+	function f(uint x) public pure {
+		assert(x > 0);
+	}
+	function g(uint y) public pure {
+		assert(y != 42);
+	}
+	function h(uint z) public pure {
+		require(z > 1);
+		assert(z != 0);
+	}
+}
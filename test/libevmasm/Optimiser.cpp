@@ -262,6 +262,23 @@ BOOST_AUTO_TEST_CASE(cse_invariants)
 	checkCSE(input, {Instruction::DUP1});
 }
 
+BOOST_AUTO_TEST_CASE(cse_expression_classes_reuse)
+{
+	ExpressionClasses classes;
+	auto findAll = [&]() {
+		ExpressionClasses::Id a = classes.find(AssemblyItem(u256(7)));
+		ExpressionClasses::Id b = classes.newClass(SourceLocation{});
+		ExpressionClasses::Id sum = classes.find(Instruction::ADD, {b, a});
+		BOOST_CHECK_EQUAL(classes.find(Instruction::ADD, {a, b}), sum);
+		BOOST_CHECK_EQUAL(classes.find(AssemblyItem(u256(7))), a);
+		return make_tuple(a, b, sum, classes.size());
+	};
+	auto ids = findAll();
+	classes.clear();
+	BOOST_CHECK_EQUAL(classes.size(), 0);
+	BOOST_CHECK(findAll() == ids);
+}
+
 BOOST_AUTO_TEST_CASE(cse_subself)
 {
 	checkCSE({Instruction::DUP1, Instruction::SUB}, {Instruction::POP, u256(0)});
@@ -1310,6 +1327,58 @@ BOOST_AUTO_TEST_CASE(jumpdest_removal_subassemblies)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(parallel_subassembly_optimisation)
+{
+	// The shared assembly is a sub-assembly of both the main assembly and its first
+	// sub-assembly, which reference different tags of it. It has to be optimised
+	// in the context of the first sub-assembly, independently of the number of threads.
+	auto createMain = []() {
+		auto createCode = [](Assembly& _assembly) {
+			auto t1 = _assembly.newTag();
+			_assembly.append(t1);
+			_assembly.append(u256(2));
+			_assembly.append(Instruction::JUMP);
+			auto t2 = _assembly.newTag();
+			_assembly.append(t2);
+			_assembly.append(u256(2));
+			_assembly.append(Instruction::JUMP);
+			_assembly.append(_assembly.newTag()); // Unreferenced
+			_assembly.append(u256(7));
+			_assembly.append(u256(8));
+			_assembly.append(Instruction::ADD);
+			return make_pair(t1, t2);
+		};
+		auto main = make_shared<Assembly>();
+		auto runtime = make_shared<Assembly>();
+		auto shared = make_shared<Assembly>();
+		auto [sharedT1, sharedT2] = createCode(*shared);
+		createCode(*runtime);
+		createCode(*main);
+		size_t sharedInRuntime = static_cast<size_t>(runtime->appendSubroutine(shared).data());
+		runtime->append(sharedT1.toSubAssemblyTag(sharedInRuntime).pushTag());
+		main->appendSubroutine(runtime);
+		size_t sharedInMain = static_cast<size_t>(main->appendSubroutine(shared).data());
+		main->append(sharedT2.toSubAssemblyTag(sharedInMain).pushTag());
+		return main;
+	};
+
+	Assembly::OptimiserSettings settings;
+	settings.isCreation = true;
+	settings.runJumpdestRemover = true;
+	settings.runPeephole = true;
+	settings.runDeduplicate = true;
+	settings.runCSE = true;
+	settings.runConstantOptimiser = true;
+	settings.evmVersion = solidity::test::CommonOptions::get().evmVersion();
+
+	auto sequential = createMain();
+	sequential->optimise(settings);
+	auto parallel = createMain();
+	parallel->optimise(settings, 4);
+	BOOST_CHECK_EQUAL(sequential->assemblyString(), parallel->assemblyString());
+	BOOST_CHECK(sequential->assemble().bytecode == parallel->assemble().bytecode);
+}
+
 BOOST_AUTO_TEST_CASE(cse_sub_zero)
 {
 	checkCSE({
@@ -48,6 +48,19 @@ BOOST_AUTO_TEST_CASE(test_fail)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(shared_source)
+{
+	util::SharedTextPointer text = util::SharedText::fromString("contract C {}");
+	CharStream source(text, "source");
+	CharStream copy = source;
+
+	BOOST_CHECK(source.source() == "contract C {}");
+	BOOST_CHECK(source.source().data() == text->view().data());
+	BOOST_CHECK(copy.source().data() == text->view().data());
+	BOOST_CHECK('c' == source.get());
+	BOOST_CHECK('o' == source.advanceAndGet());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -22,10 +22,16 @@
 
 #include <liblangutil/Scanner.h>
 
+#include <libsolutil/SharedText.h>
+
+#include <test/FilesystemUtils.h>
+#include <test/TemporaryDirectory.h>
+
 #include <boost/test/unit_test.hpp>
 
 using namespace std;
 using namespace solidity::langutil;
+using namespace solidity::test;
 
 namespace solidity::langutil::test
 {
@@ -895,6 +901,52 @@ BOOST_AUTO_TEST_CASE(irregular_line_breaks_in_strings)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(long_tokens)
+{
+	// The scanner skips over runs of characters in blocks,
+	// so the interesting characters are placed at all offsets within a block.
+	for (size_t length = 1; length <= 40; ++length)
+	{
+		string const run(length, 'x');
+
+		TestScanner scanner(run + "+" + run + "$9 " + run + ".y");
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), run);
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Add);
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), run + "$9");
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), run);
+		scanner.reset(run + ".y");
+		scanner.scanner->setScannerMode(ScannerKind::Yul);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), run + ".y");
+
+		scanner.reset("\"" + run + "\\n" + run + "\"" + string(length, ' ') + "\t\"" + run + "\x01\"");
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::StringLiteral);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), run + "\n" + run);
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Illegal);
+		BOOST_CHECK_EQUAL(scanner.currentError(), ScannerError::IllegalCharacterInString);
+
+		scanner.reset("unicode\"" + run + "\xC3\xA4\"");
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::UnicodeStringLiteral);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), run + "\xC3\xA4");
+
+		scanner.reset("// " + run + "\xE2\x80\xA8" + run);
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Illegal);
+
+		scanner.reset("/// " + run + "\n/// " + run + "\nz");
+		BOOST_CHECK_EQUAL(scanner.currentCommentLiteral(), run + "\n " + run);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), "z");
+
+		scanner.reset("/** " + run + "\n * " + run + "*" + run + " */z");
+		BOOST_CHECK_EQUAL(scanner.currentCommentLiteral(), run + "\n " + run + "*" + run + " ");
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), "z");
+
+		scanner.reset("/* " + run + "*" + run + " */" + string(length, '\n') + "z");
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), "z");
+		BOOST_CHECK_EQUAL(scanner.currentLocation().start, static_cast<int>(3 * length + 7));
+	}
+}
+
 BOOST_AUTO_TEST_CASE(solidity_keywords)
 {
 	// These are tokens which have a different meaning in Yul.
@@ -1026,6 +1078,44 @@ BOOST_AUTO_TEST_CASE(yul_function_with_whitespace)
 	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
 }
 
+BOOST_AUTO_TEST_CASE(mapped_file_up_to_end)
+{
+	// Files of this size are mapped into memory. The mapping ends exactly at a page boundary and
+	// is not null-terminated, so the scanner must not read past its last character.
+	size_t constexpr size = 64 * 1024;
+	string const body = "contract C { function f() public { uint x = 0x1234; } } /* comment */ // comment\n";
+	vector<string> const endings{"identifier", "   \t  ", "// comment", "/* unterminated", "\"unterminated", "1234"};
+	TemporaryDirectory tempDir("scanner-test");
+	for (size_t i = 0; i < endings.size(); ++i)
+	{
+		string const& ending = endings[i];
+		boost::filesystem::path const file = tempDir.path() / ("mapped" + std::to_string(i) + ".sol");
+		string content;
+		while (content.size() + body.size() + ending.size() <= size)
+			content += body;
+		content += string(size - content.size() - ending.size(), ' ') + ending;
+		BOOST_REQUIRE_EQUAL(content.size(), size);
+		createFileWithContent(file, content);
+
+		CharStream stream(util::SharedText::fromFile(file), file.filename().string());
+		BOOST_REQUIRE_EQUAL(stream.size(), size);
+		Scanner scanner(stream);
+		Token last = scanner.currentToken();
+		while (scanner.currentToken() != Token::EOS)
+		{
+			last = scanner.currentToken();
+			scanner.next();
+		}
+		BOOST_CHECK_EQUAL(scanner.currentLocation().end, static_cast<int>(size));
+		if (ending == "identifier")
+			BOOST_CHECK_EQUAL(last, Token::Identifier);
+		else if (ending == "1234")
+			BOOST_CHECK_EQUAL(last, Token::Number);
+		else if (ending == "/* unterminated" || ending == "\"unterminated")
+			BOOST_CHECK_EQUAL(last, Token::Illegal);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -0,0 +1,129 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsmtutil/QueryCache.h>
+#include <libsmtutil/SMTPortfolio.h>
+
+#include <test/TemporaryDirectory.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity::frontend;
+using namespace solidity::test;
+
+namespace solidity::smtutil::test
+{
+
+BOOST_AUTO_TEST_SUITE(QueryCacheTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(lookup_missing)
+{
+	TemporaryDirectory directory("smt-cache-test");
+	QueryCache cache(directory.path(), "z3 4.8.10\n");
+	BOOST_CHECK(!cache.lookup("(check-sat)\n"));
+}
+
+BOOST_AUTO_TEST_CASE(store_and_lookup)
+{
+	TemporaryDirectory directory("smt-cache-test");
+	QueryCache cache(directory.path(), "z3 4.8.10\n");
+	cache.store("(assert false)\n(check-sat)\n", {CheckResult::UNSATISFIABLE, {}});
+	cache.store("(assert true)\n(check-sat)\n", {CheckResult::SATISFIABLE, {"1", "true"}});
+
+	auto unsat = cache.lookup("(assert false)\n(check-sat)\n");
+	BOOST_REQUIRE(unsat);
+	BOOST_CHECK(unsat->first == CheckResult::UNSATISFIABLE);
+	BOOST_CHECK(unsat->second.empty());
+
+	auto sat = cache.lookup("(assert true)\n(check-sat)\n");
+	BOOST_REQUIRE(sat);
+	BOOST_CHECK(sat->first == CheckResult::SATISFIABLE);
+	BOOST_CHECK((sat->second == vector<string>{"1", "true"}));
+}
+
+BOOST_AUTO_TEST_CASE(indefinite_results_are_not_stored)
+{
+	TemporaryDirectory directory("smt-cache-test");
+	QueryCache cache(directory.path(), "z3 4.8.10\n");
+	cache.store("(check-sat)\n", {CheckResult::UNKNOWN, {}});
+	cache.store("(check-sat)\n", {CheckResult::ERROR, {}});
+	BOOST_CHECK(!cache.lookup("(check-sat)\n"));
+}
+
+BOOST_AUTO_TEST_CASE(solver_set_mismatch)
+{
+	TemporaryDirectory directory("smt-cache-test");
+	QueryCache z3Cache(directory.path(), "z3 4.8.10\ntimeout none");
+	QueryCache otherVersionCache(directory.path(), "z3 4.8.11\ntimeout none");
+	QueryCache otherTimeoutCache(directory.path(), "z3 4.8.10\ntimeout 1000");
+	z3Cache.store("(check-sat)\n", {CheckResult::UNSATISFIABLE, {}});
+	BOOST_CHECK(z3Cache.lookup("(check-sat)\n"));
+	BOOST_CHECK(!otherVersionCache.lookup("(check-sat)\n"));
+	BOOST_CHECK(!otherTimeoutCache.lookup("(check-sat)\n"));
+}
+
+BOOST_AUTO_TEST_CASE(reuse_in_second_run)
+{
+	TemporaryDirectory directory("smt-cache-test");
+	{
+		QueryCache firstRun(directory.path(), "z3 4.8.10\n");
+		firstRun.store("(check-sat)\n", {CheckResult::SATISFIABLE, {"42"}});
+	}
+
+	QueryCache secondRun(directory.path(), "z3 4.8.10\n");
+	auto cached = secondRun.lookup("(check-sat)\n");
+	BOOST_REQUIRE(cached);
+	BOOST_CHECK(cached->first == CheckResult::SATISFIABLE);
+	BOOST_CHECK((cached->second == vector<string>{"42"}));
+}
+
+BOOST_AUTO_TEST_CASE(portfolio_hands_cached_queries_to_smtlib2)
+{
+	TemporaryDirectory directory("smt-cache-test");
+	auto check = [&](ReadCallback::Callback _callback) {
+		SMTPortfolio portfolio({}, move(_callback), SMTSolverChoice::SMTLIB2(), nullopt, directory.path());
+		Expression x = portfolio.newVariable("x", SortProvider::sintSort);
+		portfolio.addAssertion(x > 0);
+		portfolio.addAssertion(x < 0);
+		auto result = portfolio.check({});
+		return make_pair(result.first, portfolio.unhandledQueries());
+	};
+
+	size_t callbackCalls = 0;
+	auto [result, unhandled] = check([&](string const&, string const&) {
+		++callbackCalls;
+		return ReadCallback::Result{true, "unsat\n"};
+	});
+	BOOST_CHECK(result == CheckResult::UNSATISFIABLE);
+	BOOST_CHECK(unhandled.empty());
+	BOOST_CHECK_EQUAL(callbackCalls, 1);
+
+	// The answer is taken from the cache, but the query still has to reach the caller.
+	tie(result, unhandled) = check({});
+	BOOST_CHECK(result == CheckResult::UNSATISFIABLE);
+	BOOST_REQUIRE_EQUAL(unhandled.size(), 1);
+	BOOST_CHECK(unhandled.front().find("(check-sat)") != string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -113,6 +113,93 @@ BOOST_AUTO_TEST_CASE(context_dependent_remappings_order_independent_2)
 	BOOST_CHECK(c.compile());
 }
 
+BOOST_AUTO_TEST_CASE(incremental_analysis_reuses_unchanged_sources)
+{
+	CompilerStack c;
+	c.setIncrementalAnalysis();
+	c.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	c.setSources({
+		{"a.sol", "import \"lib.sol\"; contract A is L { function f() public pure returns (uint) { return g(); } } pragma solidity >=0.0;"},
+		{"lib.sol", "contract L { function g() internal pure returns (uint) { return 1; } } pragma solidity >=0.0;"}
+	});
+	BOOST_REQUIRE(c.compile());
+	SourceUnit const* libAST = &c.ast("lib.sol");
+	SourceUnit const* mainAST = &c.ast("a.sol");
+
+	c.reset(true);
+	c.setSources({
+		{"a.sol", "import \"lib.sol\"; contract A is L { function f() public pure returns (uint) { return g() + 1; } } pragma solidity >=0.0;"},
+		{"lib.sol", "contract L { function g() internal pure returns (uint) { return 1; } } pragma solidity >=0.0;"}
+	});
+	BOOST_REQUIRE(c.compile());
+	BOOST_CHECK(&c.ast("lib.sol") == libAST);
+	BOOST_CHECK(&c.ast("a.sol") != mainAST);
+
+	c.reset(true);
+	c.setSources({
+		{"a.sol", "import \"lib.sol\"; contract A is L { function f() public pure returns (uint) { return g(); } } pragma solidity >=0.0;"},
+		{"lib.sol", "contract L { function h() internal pure returns (uint) { return 1; } } pragma solidity >=0.0;"}
+	});
+	BOOST_CHECK(!c.compile());
+	BOOST_CHECK(&c.ast("lib.sol") != libAST);
+}
+
+BOOST_AUTO_TEST_CASE(incremental_analysis_bounds_retired_asts)
+{
+	CompilerStack c;
+	c.setIncrementalAnalysis();
+	c.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	auto compile = [&](size_t _version) {
+		c.reset(true);
+		c.setSources({
+			{"a.sol", "import \"lib.sol\"; contract A is L { uint x = " + to_string(_version) + "; } pragma solidity >=0.0;"},
+			{"lib.sol", "contract L { function g() internal pure returns (uint) { return 1; } } pragma solidity >=0.0;"}
+		});
+		BOOST_REQUIRE(c.compile());
+		return &c.ast("lib.sol");
+	};
+
+	SourceUnit const* libAST = compile(0);
+	// Every compilation replaces one AST. The unchanged source is reused until there are more
+	// replaced ASTs than sources, then everything is analysed again.
+	BOOST_CHECK(compile(1) == libAST);
+	BOOST_CHECK(compile(2) == libAST);
+	BOOST_CHECK(compile(3) == libAST);
+	SourceUnit const* newLibAST = compile(4);
+	BOOST_CHECK(newLibAST != libAST);
+	BOOST_CHECK(compile(5) == newLibAST);
+}
+
+BOOST_AUTO_TEST_CASE(incremental_analysis_diagnostics_order)
+{
+	CompilerStack c;
+	c.setIncrementalAnalysis();
+	c.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	string const lib = "contract L { function g() public { uint x; } } pragma solidity >=0.0;";
+	auto warningSources = [&](string const& _main) {
+		c.reset(true);
+		c.setSources({
+			{"a.sol", "import \"lib.sol\"; contract A is L { function f() public { " + _main + " } } pragma solidity >=0.0;"},
+			{"lib.sol", lib}
+		});
+		BOOST_REQUIRE(c.compile());
+		vector<string> sources;
+		for (auto const& error: c.errors())
+			if (auto location = boost::get_error_info<langutil::errinfo_sourceLocation>(*error))
+				sources.push_back(*location->sourceName);
+		return sources;
+	};
+
+	// The warnings of the reused source are merged in, but keep their place in front of the
+	// ones of the source importing it.
+	vector<string> fresh = warningSources("uint y;");
+	vector<string> reused = warningSources("uint z;");
+	BOOST_REQUIRE(!fresh.empty());
+	BOOST_CHECK(fresh == reused);
+	BOOST_CHECK_EQUAL(fresh.front(), "lib.sol");
+	BOOST_CHECK_EQUAL(fresh.back(), "a.sol");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -52,7 +52,8 @@ ASTPointer<ContractDefinition> parseText(std::string const& _source, ErrorList&
 		return ASTPointer<ContractDefinition>();
 	for (ASTPointer<ASTNode> const& node: sourceUnit->nodes())
 		if (ASTPointer<ContractDefinition> contract = dynamic_pointer_cast<ContractDefinition>(node))
-			return contract;
+			// The nodes live in the arena owned by the source unit, so it has to be kept alive.
+			return ASTPointer<ContractDefinition>(sourceUnit, contract.get());
 	BOOST_FAIL("No contract found in source.");
 	return ASTPointer<ContractDefinition>();
 }
@@ -612,6 +613,59 @@ BOOST_AUTO_TEST_CASE(inline_asm_end_location)
 	BOOST_CHECK_MESSAGE(visitor.visited, "No inline asm block found?!");
 }
 
+BOOST_AUTO_TEST_CASE(ast_arena_allocation)
+{
+	ASTArena arena;
+	BOOST_CHECK_EQUAL(arena.reservedBytes(), 0);
+
+	auto first = static_cast<std::byte*>(arena.allocate(1, 1));
+	auto second = static_cast<std::byte*>(arena.allocate(8, 8));
+	BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(second) % 8, 0);
+	BOOST_CHECK(first < second && second < first + 16);
+	size_t const reserved = arena.reservedBytes();
+	BOOST_CHECK(reserved > 0);
+
+	// Large objects get a block of their own, the following ones still use the current block.
+	void* large = arena.allocate(100000, 8);
+	BOOST_CHECK_EQUAL(arena.reservedBytes(), reserved + 100000);
+	BOOST_CHECK(static_cast<std::byte*>(arena.allocate(8, 8)) == second + 8);
+
+	BOOST_CHECK(arena.owns(first));
+	BOOST_CHECK(arena.owns(static_cast<std::byte*>(large) + 99999));
+	int onStack = 0;
+	BOOST_CHECK(!arena.owns(&onStack));
+}
+
+BOOST_AUTO_TEST_CASE(ast_arena_per_source_unit)
+{
+	ErrorList errors;
+	ErrorReporter errorReporter(errors);
+	Parser parser(errorReporter, solidity::test::CommonOptions::get().evmVersion());
+	CharStream firstSource("contract A { function f() public {} }", "a.sol");
+	CharStream secondSource("contract B {}", "b.sol");
+	ASTPointer<SourceUnit> first = parser.parse(firstSource);
+	ASTPointer<SourceUnit> second = parser.parse(secondSource);
+	BOOST_REQUIRE(first && second);
+
+	// Every source unit owns the arena of its nodes, but does not live in it itself.
+	BOOST_REQUIRE(first->arena() && second->arena());
+	BOOST_CHECK(first->arena() != second->arena());
+	BOOST_CHECK(!first->arena()->owns(first.get()));
+	auto const& contract = dynamic_cast<ContractDefinition const&>(*first->nodes().front());
+	BOOST_CHECK(first->arena()->owns(&contract));
+	BOOST_CHECK(first->arena()->owns(contract.definedFunctions().front()));
+	BOOST_CHECK(!second->arena()->owns(&contract));
+
+	// Parsing the second source does not affect the nodes of the first one.
+	BOOST_CHECK_EQUAL(contract.name(), "A");
+
+	// Releasing a source unit releases all of its nodes together with the arena.
+	weak_ptr<ASTNode> weakContract = first->nodes().front();
+	first.reset();
+	BOOST_CHECK(weakContract.expired());
+	BOOST_CHECK_EQUAL(second->nodes().size(), 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -218,6 +218,71 @@ BOOST_AUTO_TEST_CASE(type_identifiers)
 	BOOST_CHECK_EQUAL(InaccessibleDynamicType().identifier(), "t_inaccessible");
 }
 
+BOOST_AUTO_TEST_CASE(interned_types)
+{
+	Type const* uint8 = TypeProvider::uint(8);
+	Type const* bytes32 = TypeProvider::fixedBytes(32);
+
+	ArrayType const* array = TypeProvider::array(DataLocation::Memory, uint8);
+	BOOST_CHECK(array == TypeProvider::array(DataLocation::Memory, uint8));
+	BOOST_CHECK(array != TypeProvider::array(DataLocation::Storage, uint8));
+	BOOST_CHECK(array != TypeProvider::array(DataLocation::Memory, uint8, 0));
+	BOOST_CHECK(
+		TypeProvider::array(DataLocation::Memory, uint8, 3) ==
+		TypeProvider::array(DataLocation::Memory, uint8, 3)
+	);
+	BOOST_CHECK(TypeProvider::array(DataLocation::CallData, true) == TypeProvider::array(DataLocation::CallData, true));
+	BOOST_CHECK(TypeProvider::array(DataLocation::CallData, true) != TypeProvider::array(DataLocation::CallData, false));
+	BOOST_CHECK(TypeProvider::arraySlice(*array) == TypeProvider::arraySlice(*array));
+
+	ReferenceType const* copy = TypeProvider::withLocation(array, DataLocation::Storage, false);
+	BOOST_CHECK(copy == TypeProvider::withLocation(array, DataLocation::Storage, false));
+	BOOST_CHECK(copy != TypeProvider::withLocation(array, DataLocation::Storage, true));
+
+	// Types are interned by their structure, not by how they were obtained.
+	BOOST_CHECK(TypeProvider::withLocation(array, DataLocation::Storage, true) == TypeProvider::array(DataLocation::Storage, uint8));
+	BOOST_CHECK(TypeProvider::withLocation(copy, DataLocation::Memory, false) == array);
+	BOOST_CHECK(
+		TypeProvider::array(DataLocation::Memory, TypeProvider::array(DataLocation::Storage, uint8)) ==
+		TypeProvider::array(DataLocation::Memory, array)
+	);
+	BOOST_CHECK(TypeProvider::withLocation(TypeProvider::bytesMemory(), DataLocation::CallData, true) == TypeProvider::bytesCalldata());
+	BOOST_CHECK(TypeProvider::withLocation(TypeProvider::stringMemory(), DataLocation::Storage, true) == TypeProvider::stringStorage());
+
+	int64_t id = 1;
+	StructDefinition structDefinition(++id, {}, make_shared<string>("S"), {}, {});
+	StructType const* structMemory = TypeProvider::structType(structDefinition, DataLocation::Memory);
+	BOOST_CHECK(TypeProvider::withLocation(structMemory, DataLocation::Storage, true) == TypeProvider::structType(structDefinition, DataLocation::Storage));
+	BOOST_CHECK(TypeProvider::withLocation(structMemory, DataLocation::Storage, false) != TypeProvider::structType(structDefinition, DataLocation::Storage));
+	BOOST_CHECK(
+		TypeProvider::withLocation(TypeProvider::structType(structDefinition, DataLocation::CallData), DataLocation::Memory, true) ==
+		structMemory
+	);
+
+	BOOST_CHECK(TypeProvider::mapping(bytes32, array) == TypeProvider::mapping(bytes32, array));
+	BOOST_CHECK(TypeProvider::mapping(bytes32, array) != TypeProvider::mapping(array, bytes32));
+	BOOST_CHECK(TypeProvider::tuple({uint8, bytes32}) == TypeProvider::tuple({uint8, bytes32}));
+	BOOST_CHECK(TypeProvider::tuple({uint8, bytes32}) != TypeProvider::tuple({bytes32, uint8}));
+	BOOST_CHECK(TypeProvider::typeType(array) == TypeProvider::typeType(array));
+	BOOST_CHECK(TypeProvider::rationalNumber(rational(7, 2)) == TypeProvider::rationalNumber(rational(14, 4)));
+	BOOST_CHECK(TypeProvider::rationalNumber(rational(7, 2)) != TypeProvider::rationalNumber(rational(7, 2), bytes32));
+
+	FunctionType const* function = TypeProvider::function(strings{"uint8"}, strings{}, FunctionType::Kind::KECCAK256);
+	BOOST_CHECK(function == TypeProvider::function(strings{"uint8"}, strings{}, FunctionType::Kind::KECCAK256));
+	BOOST_CHECK(function != TypeProvider::function(strings{"uint8"}, strings{}, FunctionType::Kind::SHA256));
+	BOOST_CHECK(
+		TypeProvider::function(TypePointers{uint8}, TypePointers{}, strings{"x"}, strings{}) ==
+		TypeProvider::function(TypePointers{uint8}, TypePointers{}, strings{"x"}, strings{})
+	);
+	BOOST_CHECK(
+		TypeProvider::function(TypePointers{uint8}, TypePointers{}, strings{"x"}, strings{}) !=
+		TypeProvider::function(TypePointers{uint8}, TypePointers{}, strings{"y"}, strings{})
+	);
+
+	// The types of the struct refer to its definition, which does not outlive this test.
+	TypeProvider::reset();
+}
+
 BOOST_AUTO_TEST_CASE(encoded_sizes)
 {
 	BOOST_CHECK_EQUAL(IntegerType(16).calldataEncodedSize(true), 32);
@@ -28,6 +28,7 @@
 #include <libsolutil/JSON.h>
 #include <libsolutil/CommonData.h>
 #include <test/Metadata.h>
+#include <test/TemporaryDirectory.h>
 
 #include <algorithm>
 #include <set>
@@ -319,6 +320,43 @@ BOOST_AUTO_TEST_CASE(error_recovery_field)
 	BOOST_CHECK(containsAtMostWarnings(result));
 }
 
+BOOST_AUTO_TEST_CASE(parallelism_field)
+{
+	auto input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"parallelism": -1
+		},
+		"sources": {
+			"empty": {
+				"content": ""
+			}
+		}
+	}
+	)";
+
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsError(result, "JSONError", "\"settings.parallelism\" must be an unsigned integer."));
+
+	input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"parallelism": 0
+		},
+		"sources": {
+			"empty": {
+				"content": ""
+			}
+		}
+	}
+	)";
+
+	result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+}
+
 BOOST_AUTO_TEST_CASE(optimizer_enabled_not_boolean)
 {
 	char const* input = R"(
@@ -1810,6 +1848,280 @@ BOOST_AUTO_TEST_CASE(source_location_of_bare_block)
 	BOOST_REQUIRE(sourceMap.find(sourceRef) != string::npos);
 }
 
+BOOST_AUTO_TEST_CASE(cache_directory)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {
+				"content": "import \"lib.sol\"; contract A is L {}"
+			}
+		},
+		"settings": {
+			"outputSelection": {
+				"A.sol": {
+					"A": ["abi"]
+				}
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	string library = "contract L { function f() public {} }";
+	size_t reads = 0;
+	ReadCallback::Callback readFile = [&](string const& _kind, string const& _path) {
+		BOOST_REQUIRE(_kind == ReadCallback::kindString(ReadCallback::Kind::ReadFile));
+		BOOST_REQUIRE(_path == "lib.sol");
+		++reads;
+		return ReadCallback::Result{true, library};
+	};
+
+	solidity::test::TemporaryDirectory cacheDirectory("solidity-cache-test");
+	solidity::frontend::StandardCompiler compiler(readFile);
+	compiler.setCacheDirectory(cacheDirectory.path());
+
+	Json::Value result = compiler.compile(parsedInput);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	BOOST_CHECK_EQUAL(util::jsonCompactPrint(result["contracts"]["A.sol"]["A"]["abi"][0]["name"]), "\"f\"");
+	BOOST_CHECK_EQUAL(reads, 1);
+	BOOST_CHECK_EQUAL(compiler.cacheHits(), 0);
+
+	// The cached output is returned after checking that the imported file did not change.
+	// It is read back from text, so only its printed form is the same.
+	BOOST_CHECK_EQUAL(util::jsonCompactPrint(compiler.compile(parsedInput)), util::jsonCompactPrint(result));
+	BOOST_CHECK_EQUAL(reads, 2);
+	BOOST_CHECK_EQUAL(compiler.cacheHits(), 1);
+
+	// A changed import invalidates the entry, so the input is compiled again.
+	library = "contract L { function g() public {} }";
+	Json::Value changedResult = compiler.compile(parsedInput);
+	BOOST_CHECK(containsAtMostWarnings(changedResult));
+	BOOST_CHECK_EQUAL(util::jsonCompactPrint(changedResult["contracts"]["A.sol"]["A"]["abi"][0]["name"]), "\"g\"");
+	BOOST_CHECK_EQUAL(compiler.cacheHits(), 1);
+
+	// The new output replaces the old entry.
+	BOOST_CHECK_EQUAL(util::jsonCompactPrint(compiler.compile(parsedInput)), util::jsonCompactPrint(changedResult));
+	BOOST_CHECK_EQUAL(compiler.cacheHits(), 2);
+
+	// A separate compiler using the same directory finds the entry as well.
+	solidity::frontend::StandardCompiler otherCompiler(readFile);
+	otherCompiler.setCacheDirectory(cacheDirectory.path());
+	BOOST_CHECK_EQUAL(util::jsonCompactPrint(otherCompiler.compile(parsedInput)), util::jsonCompactPrint(changedResult));
+	BOOST_CHECK_EQUAL(otherCompiler.cacheHits(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(profile)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {
+				"content": "contract A { function f(uint x) public pure returns (uint) { return x + 1; } }"
+			}
+		},
+		"settings": {
+			"viaIR": true,
+			"optimizer": { "enabled": true },
+			"profile": true,
+			"outputSelection": {
+				"A.sol": {
+					"A": ["evm.bytecode.object"]
+				}
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+
+	Json::Value const& profile = result["profile"];
+	BOOST_REQUIRE(profile.isObject());
+	BOOST_REQUIRE(profile["traceEvents"].isArray());
+	BOOST_REQUIRE(profile["phases"].isArray());
+
+	set<string> phases;
+	for (Json::Value const& phase: profile["phases"])
+		phases.insert(phase["category"].asString() + ":" + phase["name"].asString());
+	BOOST_CHECK(phases.count("phase:parsing"));
+	BOOST_CHECK(phases.count("analysis:type checking"));
+	BOOST_CHECK(phases.count("codegen:IR optimization"));
+	// Optimiser steps are named by their abbreviations.
+	BOOST_CHECK(phases.count("yulOptimiserStep:s"));
+	BOOST_CHECK(!phases.count("yulOptimiserStep:ExpressionSimplifier"));
+
+	BOOST_REQUIRE(profile["contracts"]["A.sol:A"].isArray());
+	for (Json::Value const& event: profile["traceEvents"])
+		BOOST_CHECK_EQUAL(event["ph"].asString(), "X");
+
+	char const* inputWithoutProfile = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {
+				"content": "contract A {}"
+			}
+		}
+	}
+	)";
+	BOOST_CHECK(!compile(inputWithoutProfile).isMember("profile"));
+}
+
+BOOST_AUTO_TEST_CASE(profile_yul)
+{
+	char const* input = R"(
+	{
+		"language": "Yul",
+		"sources": {
+			"A.yul": {
+				"content": "{ sstore(0, add(calldataload(0), 1)) }"
+			}
+		},
+		"settings": {
+			"optimizer": { "enabled": true },
+			"profile": true,
+			"outputSelection": {
+				"A.yul": {
+					"*": ["evm.bytecode.object"]
+				}
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+
+	Json::Value const& profile = result["profile"];
+	BOOST_REQUIRE(profile.isObject());
+	set<string> phases;
+	for (Json::Value const& phase: profile["phases"])
+		phases.insert(phase["category"].asString() + ":" + phase["name"].asString());
+	BOOST_CHECK(phases.count("phase:parsing and analysis"));
+	BOOST_CHECK(phases.count("phase:optimization"));
+	BOOST_CHECK(phases.count("phase:assembly"));
+	BOOST_CHECK(phases.count("yulOptimiserStep:s"));
+}
+
+BOOST_AUTO_TEST_CASE(via_ir_bytecode_independent_of_ir_output)
+{
+	auto compileWithOutputs = [](string const& _outputs) {
+		return compile(R"(
+		{
+			"language": "Solidity",
+			"sources": {
+				"A.sol": {
+					"content": "contract B { uint x; function f(uint y) public { x = y * 2; } } contract A { function g() public returns (address) { B b = new B(); b.f(7); return address(b); } }"
+				}
+			},
+			"settings": {
+				"viaIR": true,
+				"optimizer": { "enabled": true },
+				"outputSelection": {
+					"A.sol": {
+						"A": [)" + _outputs + R"(]
+					}
+				}
+			}
+		}
+		)");
+	};
+
+	Json::Value withoutIR = compileWithOutputs(R"("evm.bytecode.object", "evm.deployedBytecode.sourceMap")");
+	Json::Value withIR = compileWithOutputs(R"("evm.bytecode.object", "evm.deployedBytecode.sourceMap", "irOptimized")");
+	BOOST_REQUIRE(containsAtMostWarnings(withoutIR));
+	BOOST_REQUIRE(containsAtMostWarnings(withIR));
+
+	Json::Value const& contractWithoutIR = withoutIR["contracts"]["A.sol"]["A"];
+	Json::Value const& contractWithIR = withIR["contracts"]["A.sol"]["A"];
+	BOOST_CHECK(!contractWithoutIR.isMember("irOptimized"));
+	BOOST_CHECK(!contractWithIR["irOptimized"].asString().empty());
+	BOOST_CHECK(!contractWithIR["evm"]["bytecode"]["object"].asString().empty());
+	BOOST_CHECK_EQUAL(
+		contractWithoutIR["evm"]["bytecode"]["object"].asString(),
+		contractWithIR["evm"]["bytecode"]["object"].asString()
+	);
+	BOOST_CHECK_EQUAL(
+		contractWithoutIR["evm"]["deployedBytecode"]["sourceMap"].asString(),
+		contractWithIR["evm"]["deployedBytecode"]["sourceMap"].asString()
+	);
+}
+
+BOOST_AUTO_TEST_CASE(ir_independent_of_other_contracts)
+{
+	auto compileContracts = [](string const& _contracts) {
+		return compile(R"(
+		{
+			"language": "Solidity",
+			"sources": {
+				"A.sol": {
+					"content": "contract A { function f(uint[] memory x) public pure returns (bytes memory) { return abi.encode(x, x.length); } } contract B { function f(uint[] calldata x) external pure returns (bytes memory) { return abi.encode(x); } } contract C { function f(uint[] memory x, string memory s) public pure returns (bytes memory) { return abi.encode(s, x); } }"
+				}
+			},
+			"settings": {
+				"outputSelection": {
+					"A.sol": {
+						)" + _contracts + R"(
+					}
+				}
+			}
+		}
+		)");
+	};
+
+	Json::Value alone = compileContracts(R"("C": ["ir"])");
+	Json::Value together = compileContracts(R"("A": ["ir"], "B": ["ir"], "C": ["ir"])");
+	BOOST_REQUIRE(containsAtMostWarnings(alone));
+	BOOST_REQUIRE(containsAtMostWarnings(together));
+
+	string const& ir = alone["contracts"]["A.sol"]["C"]["ir"].asString();
+	BOOST_CHECK(!ir.empty());
+	BOOST_CHECK_EQUAL(ir, together["contracts"]["A.sol"]["C"]["ir"].asString());
+}
+
+BOOST_AUTO_TEST_CASE(model_checker_smtlib2_targets_one_by_one)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {
+				"content": "contract C { function f(uint x) public pure { assert(x > 0); assert(x > 1); assert(x > 2); } }"
+			}
+		},
+		"settings": {
+			"modelChecker": {
+				"engine": "chc",
+				"solvers": ["smtlib2"],
+				"targets": ["assert"]
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+
+	// Without responses, every target is queried on its own and its error block is only added
+	// to the system right before its query, so the queries contain one, two and three of them.
+	Json::Value const& queries = result["auxiliaryInputRequested"]["smtlib2queries"];
+	BOOST_REQUIRE(queries.isObject());
+	BOOST_REQUIRE_EQUAL(queries.size(), 3);
+	set<size_t> errorBlocks;
+	for (Json::Value const& query: queries)
+	{
+		string const& text = query.asString();
+		BOOST_CHECK(text.find("error_any") == string::npos);
+		size_t count = 0;
+		for (size_t pos = text.find("(declare-fun |error_target_"); pos != string::npos; pos = text.find("(declare-fun |error_target_", pos + 1))
+			++count;
+		errorBlocks.insert(count);
+	}
+	BOOST_CHECK((errorBlocks == set<size_t>{1, 2, 3}));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
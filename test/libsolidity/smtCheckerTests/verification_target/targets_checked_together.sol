@@ -0,0 +1,16 @@
+contract C {
+	function f(uint x) public pure {
+		require(x < 100);
+		assert(x + 1 > x);
+		assert(x < 101);
+		assert(x != 42);
+		assert(x * 2 < 200);
+		assert(x != 7);
+		assert(x <= 99);
+	}
+}
+// ====
+// SMTEngine: chc
+// ----
+// Warning 6328: (109-124): CHC: Assertion violation happens here.\nCounterexample:\n\nx = 42\n\nTransaction trace:\nC.constructor()\nC.f(42)
+// Warning 6328: (151-165): CHC: Assertion violation happens here.\nCounterexample:\n\nx = 7\n\nTransaction trace:\nC.constructor()\nC.f(7)
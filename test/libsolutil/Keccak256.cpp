@@ -69,6 +69,33 @@ BOOST_AUTO_TEST_CASE(strings)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(batch)
+{
+	BOOST_CHECK(keccak256Batch({}).empty());
+
+	// Sizes around the rate of 136 bytes, in an order that mixes the number of blocks,
+	// and a number of inputs that does not fill all lanes of the last group.
+	vector<bytes> inputs;
+	for (size_t size: {0u, 1u, 135u, 136u, 137u, 300u, 5u, 271u, 272u, 273u, 32u, 64u, 1000u, 4096u, 2u, 136u, 135u})
+	{
+		inputs.emplace_back(size);
+		for (size_t i = 0; i < size; ++i)
+			inputs.back()[i] = static_cast<uint8_t>(i * 7 + size);
+	}
+	vector<bytesConstRef> references;
+	for (bytes const& input: inputs)
+		references.emplace_back(&input);
+
+	vector<h256> hashes = keccak256Batch(references);
+	BOOST_REQUIRE_EQUAL(hashes.size(), inputs.size());
+	for (size_t i = 0; i < inputs.size(); ++i)
+		BOOST_CHECK_EQUAL(hashes[i], keccak256(inputs[i]));
+	BOOST_CHECK_EQUAL(
+		hashes[0],
+		FixedHash<32>("0xc5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470")
+	);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,91 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Parallel.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ParallelTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(every_index_once)
+{
+	for (size_t threads: {1u, 2u, 8u})
+		for (size_t count: {0u, 1u, 5u, 100u})
+		{
+			vector<atomic<size_t>> calls(count);
+			parallelFor(count, threads, [&](size_t _index) { ++calls[_index]; });
+			for (auto const& callCount: calls)
+				BOOST_CHECK_EQUAL(callCount, 1);
+		}
+}
+
+BOOST_AUTO_TEST_CASE(repeated_calls)
+{
+	// The pool threads are reused by later calls.
+	atomic<size_t> sum{0};
+	for (size_t i = 0; i < 1000; ++i)
+		parallelFor(4, 4, [&](size_t _index) { sum += _index; });
+	BOOST_CHECK_EQUAL(sum, 6000);
+}
+
+BOOST_AUTO_TEST_CASE(nested_calls)
+{
+	vector<atomic<size_t>> calls(8 * 8);
+	parallelFor(8, 4, [&](size_t _outer) {
+		parallelFor(8, 4, [&](size_t _inner) { ++calls[_outer * 8 + _inner]; });
+	});
+	for (auto const& callCount: calls)
+		BOOST_CHECK_EQUAL(callCount, 1);
+}
+
+BOOST_AUTO_TEST_CASE(rethrows_exception_of_smallest_index)
+{
+	string message;
+	try
+	{
+		parallelFor(100, 4, [&](size_t _index) {
+			if (_index == 3 || _index == 50)
+				throw runtime_error(to_string(_index));
+		});
+	}
+	catch (runtime_error const& _exception)
+	{
+		message = _exception.what();
+	}
+	// Index 50 might not be reached, but if it is, index 3 still wins.
+	BOOST_CHECK_EQUAL(message, "3");
+
+	// The pool is still usable afterwards.
+	atomic<size_t> calls{0};
+	parallelFor(10, 4, [&](size_t) { ++calls; });
+	BOOST_CHECK_EQUAL(calls, 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,80 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+/// Unit tests for SharedText.
+
+#include <libsolutil/SharedText.h>
+
+#include <libsolutil/Exceptions.h>
+
+#include <test/FilesystemUtils.h>
+#include <test/TemporaryDirectory.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+using namespace std;
+using namespace solidity::test;
+
+#define TEST_CASE_NAME (boost::unit_test::framework::current_test_case().p_name)
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(SharedTextTest)
+
+BOOST_AUTO_TEST_CASE(from_string)
+{
+	SharedTextPointer text = SharedText::fromString("ABC\ndef\n");
+	BOOST_TEST(text->view() == "ABC\ndef\n");
+	BOOST_TEST(text->size() == 8);
+	BOOST_TEST(SharedText::fromString({})->view().empty());
+}
+
+BOOST_AUTO_TEST_CASE(from_small_file)
+{
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	createFileWithContent(tempDir.path() / "test.txt", "ABC\ndef\n");
+
+	BOOST_TEST(SharedText::fromFile(tempDir.path() / "test.txt")->view() == "ABC\ndef\n");
+}
+
+BOOST_AUTO_TEST_CASE(from_large_file)
+{
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	string content;
+	for (size_t i = 0; content.size() < 200 * 1024; ++i)
+		content += "// line " + to_string(i) + "\n";
+	createFileWithContent(tempDir.path() / "test.sol", content);
+
+	SharedTextPointer text = SharedText::fromFile(tempDir.path() / "test.sol");
+	BOOST_TEST(text->size() == content.size());
+	BOOST_TEST(text->view() == content);
+}
+
+BOOST_AUTO_TEST_CASE(from_invalid_file)
+{
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	BOOST_CHECK_THROW(SharedText::fromFile(tempDir.path() / "missing.txt"), FileNotFound);
+	BOOST_CHECK_THROW(SharedText::fromFile(tempDir.path()), NotAFile);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace solidity::util::test
@@ -208,6 +208,24 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(unclosed_tags)
+{
+	string templ = "<#l><a></m> <?+a>+<a></a> <?c><a><!c>";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "A").render(), "<#l>A</m> <?+a>+A</a> <?c>A<!c>");
+}
+
+BOOST_AUTO_TEST_CASE(same_template_several_times)
+{
+	string templ = "<?c><a><!c><#l><b></l></c>";
+	vector<map<string, string>> list(2);
+	list[0]["b"] = "1";
+	list[1]["b"] = "2";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "A")("c", true)("l", list).render(), "A");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "B")("c", false)("l", list).render(), "12");
+	Whiskers m(templ);
+	BOOST_CHECK_THROW(m("d", "D"), WhiskersError);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
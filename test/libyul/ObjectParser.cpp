@@ -28,6 +28,7 @@
 
 #include <libyul/AssemblyStack.h>
 #include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/optimiser/OptimisedCodeCache.h>
 
 #include <libsolidity/interface/OptimiserSettings.h>
 
@@ -282,6 +283,50 @@ BOOST_AUTO_TEST_CASE(use_src_leading_text)
 	BOOST_REQUIRE_EQUAL(*mapping->at(1), "misc.sol");
 }
 
+BOOST_AUTO_TEST_CASE(optimised_code_cache)
+{
+	auto wrap = [](string const& _name) {
+		return R"(
+			object ")" + _name + R"(" {
+				code {
+					let size := datasize("C")
+					datacopy(0, dataoffset("C"), size)
+					sstore(0, create(0, 0, size))
+				}
+				object "C" {
+					code {
+						function f(a) -> b { b := add(a, mul(a, 2)) }
+						sstore(f(calldataload(0)), f(calldataload(32)))
+					}
+				}
+			}
+		)";
+	};
+	auto optimize = [](string const& _code, shared_ptr<OptimisedCodeCache> _cache) {
+		AssemblyStack asmStack(
+			solidity::test::CommonOptions::get().evmVersion(),
+			AssemblyStack::Language::StrictAssembly,
+			solidity::frontend::OptimiserSettings::full(),
+			DebugInfoSelection::All()
+		);
+		BOOST_REQUIRE(asmStack.parseAndAnalyze("source", _code));
+		asmStack.setOptimisedCodeCache(move(_cache));
+		asmStack.optimize();
+		return asmStack.print();
+	};
+
+	auto cache = make_shared<OptimisedCodeCache>();
+	string firstWithCache = optimize(wrap("A"), cache);
+	BOOST_CHECK_EQUAL(cache->size(), 2);
+	BOOST_CHECK_EQUAL(cache->hits(), 0);
+	// Only the outer object differs, the shared object "C" is taken from the cache.
+	string secondWithCache = optimize(wrap("B"), cache);
+	BOOST_CHECK_EQUAL(cache->size(), 3);
+	BOOST_CHECK_EQUAL(cache->hits(), 1);
+	BOOST_CHECK_EQUAL(firstWithCache, optimize(wrap("A"), nullptr));
+	BOOST_CHECK_EQUAL(secondWithCache, optimize(wrap("B"), nullptr));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
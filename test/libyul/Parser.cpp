@@ -951,6 +951,38 @@ BOOST_AUTO_TEST_CASE(customSourceLocations_multiple_src_tags_on_one_line)
 	CHECK_LOCATION(varX.debugData->originLocation, "source1", 4, 5);
 }
 
+BOOST_AUTO_TEST_CASE(debug_data_owned_by_ast)
+{
+	ErrorList errorList;
+	ErrorReporter reporter(errorList);
+	auto const sourceText =
+		"/// @src 0:234:543\n"
+		"{ function f() {} }\n";
+	EVMDialectTyped const& dialect = EVMDialectTyped::instance(EVMVersion{});
+	shared_ptr<Block> result = parse(sourceText, dialect, reporter);
+	BOOST_REQUIRE(!!result && errorList.size() == 0);
+	BOOST_REQUIRE(holds_alternative<FunctionDefinition>(result->statements.at(0)));
+	FunctionDefinition const& funDef = get<FunctionDefinition>(result->statements.at(0));
+	// The ends of the locations are updated without leaving copies behind.
+	CHECK_LOCATION(result->debugData->nativeLocation, "", 19, 38);
+	CHECK_LOCATION(funDef.debugData->nativeLocation, "", 21, 36);
+	BOOST_CHECK_EQUAL(result->debugData.use_count(), 1);
+	BOOST_CHECK_EQUAL(funDef.debugData.use_count(), 1);
+
+	weak_ptr<DebugData const> blockDebugData = result->debugData;
+	weak_ptr<DebugData const> functionDebugData = funDef.debugData;
+	result.reset();
+	BOOST_CHECK(blockDebugData.expired());
+	BOOST_CHECK(functionDebugData.expired());
+}
+
+BOOST_AUTO_TEST_CASE(empty_debug_data_shared)
+{
+	BOOST_CHECK(DebugData::create() == DebugData::create());
+	BOOST_CHECK(DebugData::create()->astID == nullopt);
+	BOOST_CHECK(DebugData::create({}, {}, 1) != DebugData::create({}, {}, 1));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -87,6 +87,34 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 
 	auto const printed = (m_object->subObjects.empty() ? AsmPrinter{ *m_dialect }(*m_object->code) : m_object->toString(m_dialect));
 
+	if (m_optimizerStep == "fullSuite")
+	{
+		// Neither skipping steps that did not change the code before nor optimising
+		// functions concurrently may affect the result.
+		for (auto const& [skipStableSteps, parallelism]: {pair<bool, size_t>{false, 1}, {true, 4}})
+		{
+			auto [object, analysisInfo] = parse(_stream, _linePrefix, _formatted, m_source);
+			soltestAssert(object, "");
+			object->analysisInfo = analysisInfo;
+			YulOptimizerTestCommon variantTester(object, *m_dialect);
+			variantTester.setStep(m_optimizerStep);
+			variantTester.setSkipStableSteps(skipStableSteps);
+			variantTester.setParallelism(parallelism);
+			soltestAssert(variantTester.runStep(), "");
+			auto const printedVariant =
+				(object->subObjects.empty() ? AsmPrinter{*m_dialect}(*object->code) : object->toString(m_dialect));
+			if (printedVariant != printed)
+			{
+				AnsiColorized(_stream, _formatted, {formatting::BOLD, formatting::RED})
+					<< _linePrefix << "Result differs "
+					<< (skipStableSteps ? "when optimising on " + to_string(parallelism) + " threads:" : "when no optimiser steps are skipped:")
+					<< endl;
+				printIndented(_stream, printedVariant, _linePrefix + "  ");
+				return TestResult::Failure;
+			}
+		}
+	}
+
 	// Re-parse new code for compilability
 	// TODO: support for wordSizeTransform which needs different input and output dialects
 	if (m_optimizerStep != "wordSizeTransform" && !std::get<0>(parse(_stream, _linePrefix, _formatted, printed)))
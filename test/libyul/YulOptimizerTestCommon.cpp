@@ -322,7 +322,10 @@ YulOptimizerTestCommon::YulOptimizerTestCommon(
 				*m_object,
 				true,
 				frontend::OptimiserSettings::DefaultYulOptimiserSteps,
-				frontend::OptimiserSettings::standard().expectedExecutionsPerDeployment
+				frontend::OptimiserSettings::standard().expectedExecutionsPerDeployment,
+				{},
+				m_parallelism,
+				m_skipStableSteps
 			);
 		}},
 		{"stackLimitEvader", [&]() {
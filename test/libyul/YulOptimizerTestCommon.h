@@ -45,6 +45,11 @@ public:
 	/// Sets optimiser step to be run to @param
 	/// _optimiserStep.
 	void setStep(std::string const& _optimizerStep);
+	/// Sets whether the full suite skips steps that already ran
+	/// on the current code without changing it.
+	void setSkipStableSteps(bool _skipStableSteps) { m_skipStableSteps = _skipStableSteps; }
+	/// Sets the number of threads the full suite uses to optimise functions concurrently.
+	void setParallelism(size_t _parallelism) { m_parallelism = _parallelism; }
 	/// Runs chosen optimiser step returning pointer
 	/// to yul AST Block post optimisation.
 	std::shared_ptr<Block> run();
@@ -61,6 +66,8 @@ private:
 	void updateContext();
 
 	std::string m_optimizerStep;
+	bool m_skipStableSteps = true;
+	size_t m_parallelism = 1;
 
 	Dialect const* m_dialect = nullptr;
 	std::set<YulString> m_reservedIdentifiers;
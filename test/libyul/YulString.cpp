@@ -0,0 +1,75 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the Yul string repository.
+ */
+
+#include <libyul/YulString.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <thread>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulStringRepositoryTest)
+
+BOOST_AUTO_TEST_CASE(identical_strings)
+{
+	YulString a("yulStringTest_a");
+	BOOST_CHECK(a == YulString("yulStringTest_a"));
+	BOOST_CHECK(a != YulString("yulStringTest_b"));
+	BOOST_CHECK_EQUAL(a.str(), "yulStringTest_a");
+	BOOST_CHECK_EQUAL(a.hash(), YulStringRepository::hash("yulStringTest_a"));
+	BOOST_CHECK(YulString("").empty());
+	BOOST_CHECK(YulString() == YulString(""));
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_insertion)
+{
+	size_t const stringCount = 5000;
+	vector<vector<YulString>> strings(4);
+	atomic<bool> mismatch{false};
+	vector<thread> threads;
+	for (size_t i = 0; i < strings.size(); ++i)
+		threads.emplace_back([&, i]() {
+			for (size_t j = 0; j < stringCount; ++j)
+			{
+				string value = "yulStringTest_" + to_string(j);
+				strings[i].emplace_back(value);
+				if (strings[i].back().str() != value)
+					mismatch = true;
+			}
+		});
+	for (thread& t: threads)
+		t.join();
+
+	BOOST_CHECK(!mismatch);
+	for (size_t i = 1; i < strings.size(); ++i)
+		BOOST_CHECK(strings[i] == strings[0]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
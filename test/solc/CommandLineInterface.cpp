@@ -1326,6 +1326,21 @@ BOOST_AUTO_TEST_CASE(cli_include_paths_ambiguous_import)
 	BOOST_REQUIRE(!result.success);
 }
 
+BOOST_AUTO_TEST_CASE(cli_time_report)
+{
+	OptionsReaderAndMessages result = parseCommandLineAndReadInputFiles(
+		{"solc", "--time-report", "-"},
+		"// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0;\ncontract C {}\n",
+		true /* _processInput */
+	);
+
+	BOOST_TEST(result.success);
+	BOOST_TEST(result.stdoutContent.find("======= Time report =======") != string::npos);
+	BOOST_TEST(result.stdoutContent.find("\"traceEvents\"") != string::npos);
+	// The report is the requested output.
+	BOOST_TEST(result.stderrContent.find("no output requested") == string::npos);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace solidity::frontend::test
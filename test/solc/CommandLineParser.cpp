@@ -132,6 +132,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--experimental-via-ir",
 			"--revert-strings=strip",
 			"--debug-info=location",
+			"--jobs=4",
 			"--pretty-json",
 			"--json-indent=7",
 			"--no-color",
@@ -142,6 +143,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--ast-compact-json", "--asm", "--asm-json", "--opcodes", "--bin", "--bin-runtime", "--abi",
 			"--ir", "--ir-optimized", "--ewasm", "--hashes", "--userdoc", "--devdoc", "--metadata", "--storage-layout",
 			"--gas",
+			"--time-report",
 			"--combined-json="
 				"abi,metadata,bin,bin-runtime,opcodes,asm,storage-layout,generated-sources,generated-sources-runtime,"
 				"srcmap,srcmap-runtime,function-debug,function-debug-runtime,hashes,devdoc,userdoc,ast",
@@ -150,6 +152,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--optimize",
 			"--optimize-runs=1000",
 			"--yul-optimizations=agf",
+			"--model-checker-cache-dir=/tmp/smt-cache",
 			"--model-checker-contracts=contract1.yul:A,contract2.yul:B",
 			"--model-checker-div-mod-no-slacks",
 			"--model-checker-engine=bmc",
@@ -158,6 +161,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--model-checker-solvers=z3,smtlib2",
 			"--model-checker-targets=underflow,divByZero",
 			"--model-checker-timeout=5",
+			"--model-checker-time-budget=1000",
 		};
 
 		if (inputMode == InputMode::CompilerWithASTImport)
@@ -187,6 +191,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 		expectedOptions.output.experimentalViaIR = true;
 		expectedOptions.output.revertStrings = RevertStrings::Strip;
 		expectedOptions.output.debugInfoSelection = DebugInfoSelection::fromString("location");
+		expectedOptions.output.jobs = 4;
 		expectedOptions.formatting.json = JsonFormat{JsonFormat::Pretty, 7};
 		expectedOptions.linker.libraries = {
 			{"dir1/file1.sol:L", h160("1234567890123456789012345678901234567890")},
@@ -202,6 +207,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 		};
 		expectedOptions.compiler.outputs.ewasmIR = false;
 		expectedOptions.compiler.estimateGas = true;
+		expectedOptions.compiler.timeReport = true;
 		expectedOptions.compiler.combinedJsonRequests = {
 			true, true, true, true, true,
 			true, true, true, true, true,
@@ -224,6 +230,8 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			{false, true, true},
 			{{VerificationTargetType::Underflow, VerificationTargetType::DivByZero}},
 			5,
+			1000,
+			"/tmp/smt-cache",
 		};
 
 		stringstream serr;
@@ -287,6 +295,7 @@ BOOST_AUTO_TEST_CASE(assembly_mode_options)
 				"dir2/file2.sol:L=0x1111122222333334444455555666667777788888",
 			"--metadata-hash=swarm",       // Ignored in assembly mode
 			"--metadata-literal",          // Ignored in assembly mode
+			"--model-checker-cache-dir=/tmp/smt-cache", // Ignored in assembly mode
 			"--model-checker-contracts="   // Ignored in assembly mode
 				"contract1.yul:A,"
 				"contract2.yul:B",
@@ -299,6 +308,7 @@ BOOST_AUTO_TEST_CASE(assembly_mode_options)
 				"underflow,"
 				"divByZero",
 			"--model-checker-timeout=5",   // Ignored in assembly mode
+			"--model-checker-time-budget=1000", // Ignored in assembly mode
 			"--asm",
 			"--bin",
 			"--ir-optimized",
@@ -372,6 +382,7 @@ BOOST_AUTO_TEST_CASE(standard_json_mode_options)
 		"--include-path=/home/user/include",
 		"--allow-paths=/tmp,/home,project,../contracts",
 		"--ignore-missing",
+		"--cache-dir=/tmp/cache",
 		"--output-dir=/tmp/out",           // Accepted but has no effect in Standard JSON mode
 		"--overwrite",                     // Accepted but has no effect in Standard JSON mode
 		"--evm-version=spuriousDragon",    // Ignored in Standard JSON mode
@@ -387,6 +398,7 @@ BOOST_AUTO_TEST_CASE(standard_json_mode_options)
 		"--combined-json=abi,bin",         // Accepted but has no effect in Standard JSON mode
 		"--metadata-hash=swarm",           // Ignored in Standard JSON mode
 		"--metadata-literal",              // Ignored in Standard JSON mode
+		"--model-checker-cache-dir=/tmp/smt-cache", // Ignored in Standard JSON mode
 		"--model-checker-contracts="       // Ignored in Standard JSON mode
 			"contract1.yul:A,"
 			"contract2.yul:B",
@@ -399,6 +411,7 @@ BOOST_AUTO_TEST_CASE(standard_json_mode_options)
 			"underflow,"
 			"divByZero",
 		"--model-checker-timeout=5",       // Ignored in Standard JSON mode
+		"--model-checker-time-budget=1000", // Ignored in Standard JSON mode
 	};
 
 	CommandLineOptions expectedOptions;
@@ -409,6 +422,7 @@ BOOST_AUTO_TEST_CASE(standard_json_mode_options)
 	expectedOptions.input.includePaths = {"/usr/lib/include/", "/home/user/include"};
 	expectedOptions.input.allowedDirectories = {"/tmp", "/home", "project", "../contracts"};
 	expectedOptions.input.ignoreMissingFiles = true;
+	expectedOptions.input.cacheDirectory = "/tmp/cache";
 	expectedOptions.output.dir = "/tmp/out";
 	expectedOptions.output.overwriteFiles = true;
 	expectedOptions.output.revertStrings = RevertStrings::Strip;
@@ -20,6 +20,7 @@
 
 #include <solc/CommandLineInterface.h>
 
+#include <regex>
 #include <sstream>
 
 using namespace std;
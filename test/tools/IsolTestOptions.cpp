@@ -70,7 +70,10 @@ void IsolTestOptions::addOptions()
 		("help", po::bool_switch(&showHelp)->default_value(showHelp), "Show this help screen.")
 		("no-color", po::bool_switch(&noColor)->default_value(noColor), "Don't use colors.")
 		("accept-updates", po::bool_switch(&acceptUpdates)->default_value(acceptUpdates), "Automatically accept expectation updates.")
-		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.");
+		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.")
+		("jobs,j", po::value<size_t>(&jobs)->default_value(jobs), "Number of worker processes running tests at the same time. Failing tests are not handled interactively if greater than one.")
+		("shard", po::value<std::string>(&shard), "Only run the i-th of n equally sized subsets of the tests of each suite, given as i/n with 0 <= i < n.")
+		("timing-report", po::value<std::string>(&timingReport), "Write the run time of every test to the given file as JSON and print the slowest tests.");
 }
 
 bool IsolTestOptions::parse(int _argc, char const* const* _argv)
@@ -85,6 +88,18 @@ bool IsolTestOptions::parse(int _argc, char const* const* _argv)
 
 	enforceGasTest = enforceGasTest || (evmVersion() == langutil::EVMVersion{} && !useABIEncoderV1);
 
+	if (!shard.empty())
+	{
+		std::smatch match;
+		assertThrow(
+			regex_match(shard, match, std::regex{"([0-9]+)/([0-9]+)"}),
+			ConfigException,
+			"Invalid shard - expected i/n: " + shard
+		);
+		shardIndex = std::stoul(match[1]);
+		shardCount = std::stoul(match[2]);
+	}
+
 	return res;
 }
 
@@ -98,6 +113,15 @@ void IsolTestOptions::validate() const
 		ConfigException,
 		"Invalid test unit filter - can only contain '" + filterString + ": " + testFilter
 	);
+	assertThrow(jobs > 0, ConfigException, "The number of jobs must be positive.");
+#if defined(_WIN32)
+	assertThrow(jobs == 1, ConfigException, "Running tests in parallel is not supported on Windows.");
+#endif
+	assertThrow(
+		shardCount > 0 && shardIndex < shardCount,
+		ConfigException,
+		"Invalid shard - expected i/n with 0 <= i < n: " + shard
+	);
 }
 
 }
@@ -34,11 +34,21 @@ struct IsolTestOptions: CommonOptions
 	bool acceptUpdates = false;
 	std::string testFilter = std::string{};
 	std::string editor = std::string{};
+	/// Number of worker processes that run the tests of a suite.
+	size_t jobs = 1;
+	/// Only the tests whose index in the sorted list of tests of a suite modulo shardCount
+	/// equals shardIndex are run.
+	size_t shardIndex = 0;
+	size_t shardCount = 1;
+	std::string timingReport = std::string{};
 
 	explicit IsolTestOptions();
 	void addOptions() override;
 	bool parse(int _argc, char const* const* _argv) override;
 	void validate() const override;
+
+private:
+	std::string shard = std::string{};
 };
 
 }
@@ -25,17 +25,31 @@
 #include <test/InteractiveTests.h>
 #include <test/EVMHost.h>
 
+#include <libsolutil/Common.h>
+#include <libsolutil/JSON.h>
+
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <queue>
 #include <regex>
+#include <sstream>
 #include <utility>
 
 #if defined(_WIN32)
 #include <windows.h>
+#else
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #endif
 
 using namespace std;
@@ -51,17 +65,26 @@ namespace fs = boost::filesystem;
 using TestCreator = TestCase::TestCaseCreator;
 using TestOptions = solidity::test::IsolTestOptions;
 
+struct TestTiming
+{
+	string name;
+	string result;
+	chrono::microseconds duration;
+};
+
 struct TestStats
 {
 	int successCount = 0;
 	int testCount = 0;
 	int skippedCount = 0;
+	vector<TestTiming> timings;
 	operator bool() const noexcept { return successCount + skippedCount == testCount; }
-	TestStats& operator+=(TestStats const& _other) noexcept
+	TestStats& operator+=(TestStats const& _other)
 	{
 		successCount += _other.successCount;
 		testCount += _other.testCount;
 		skippedCount += _other.skippedCount;
+		timings.insert(timings.end(), _other.timings.begin(), _other.timings.end());
 		return *this;
 	}
 };
@@ -96,13 +119,15 @@ public:
 		TestCreator _testCaseCreator,
 		TestOptions const& _options,
 		fs::path _path,
-		string _name
+		string _name,
+		ostream& _output = cout
 	):
 		m_testCaseCreator(_testCaseCreator),
 		m_options(_options),
 		m_filter(TestFilter{_options.testFilter}),
 		m_path(std::move(_path)),
-		m_name(std::move(_name))
+		m_name(std::move(_name)),
+		m_output(_output)
 	{}
 
 	enum class Result
@@ -131,12 +156,44 @@ private:
 
 	void updateTestCase();
 	Request handleResponse(bool _exception);
+	static string resultName(Result _result);
+	/// @returns the timing of a run of the test with the given result and duration or nullopt
+	/// if the test does not match the filter.
+	optional<TestTiming> timing(Result _result, chrono::microseconds _duration) const;
+
+	/// @returns the paths of the test files in @a _path relative to @a _basepath in
+	/// lexicographical order, restricted to the shard selected in @a _options.
+	static vector<fs::path> collectTests(TestOptions const& _options, fs::path const& _basepath, fs::path const& _path);
+	/// Runs the tests one after the other and asks the user how to handle failures.
+	static TestStats processSequentially(
+		TestCreator _testCaseCreator,
+		TestOptions const& _options,
+		fs::path const& _basepath,
+		vector<fs::path> const& _tests
+	);
+	/// Runs the tests in _options.jobs worker processes. Failures are reported but not handled interactively.
+	static TestStats processInParallel(
+		TestCreator _testCaseCreator,
+		TestOptions const& _options,
+		fs::path const& _basepath,
+		vector<fs::path> const& _tests
+	);
+	/// Runs a single test, updating its expectations until it passes if requested by the options.
+	/// @returns the result and the time spent, which is only set if the test matched the filter.
+	static pair<Result, optional<TestTiming>> runTest(
+		TestCreator _testCaseCreator,
+		TestOptions const& _options,
+		fs::path const& _basepath,
+		fs::path const& _test,
+		ostream& _output
+	);
 
 	TestCreator m_testCaseCreator;
 	TestOptions const& m_options;
 	TestFilter m_filter;
 	fs::path const m_path;
 	string const m_name;
+	ostream& m_output;
 
 	unique_ptr<TestCase> m_test;
 
@@ -153,7 +210,7 @@ TestTool::Result TestTool::process()
 	{
 		if (m_filter.matches(m_path, m_name))
 		{
-			(AnsiColorized(cout, formatted, {BOLD}) << m_name << ": ").flush();
+			(AnsiColorized(m_output, formatted, {BOLD}) << m_name << ": ").flush();
 
 			m_test = m_testCaseCreator(TestCase::Config{
 				m_path.string(),
@@ -170,22 +227,22 @@ TestTool::Result TestTool::process()
 				switch (TestCase::TestResult result = m_test->run(outputMessages, "  ", formatted))
 				{
 					case TestCase::TestResult::Success:
-						AnsiColorized(cout, formatted, {BOLD, GREEN}) << "OK" << endl;
+						AnsiColorized(m_output, formatted, {BOLD, GREEN}) << "OK" << endl;
 						return Result::Success;
 					default:
-						AnsiColorized(cout, formatted, {BOLD, RED}) << "FAIL" << endl;
+						AnsiColorized(m_output, formatted, {BOLD, RED}) << "FAIL" << endl;
 
-						AnsiColorized(cout, formatted, {BOLD, CYAN}) << "  Contract:" << endl;
-						m_test->printSource(cout, "    ", formatted);
-						m_test->printSettings(cout, "    ", formatted);
+						AnsiColorized(m_output, formatted, {BOLD, CYAN}) << "  Contract:" << endl;
+						m_test->printSource(m_output, "    ", formatted);
+						m_test->printSettings(m_output, "    ", formatted);
 
-						cout << endl << outputMessages.str() << endl;
+						m_output << endl << outputMessages.str() << endl;
 						return result == TestCase::TestResult::FatalError ? Result::Exception : Result::Failure;
 				}
 			}
 			else
 			{
-				AnsiColorized(cout, formatted, {BOLD, YELLOW}) << "NOT RUN" << endl;
+				AnsiColorized(m_output, formatted, {BOLD, YELLOW}) << "NOT RUN" << endl;
 				return Result::Skipped;
 			}
 		}
@@ -194,19 +251,19 @@ TestTool::Result TestTool::process()
 	}
 	catch (boost::exception const& _e)
 	{
-		AnsiColorized(cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(m_output, formatted, {BOLD, RED}) <<
 			"Exception during test: " << boost::diagnostic_information(_e) << endl;
 		return Result::Exception;
 	}
 	catch (std::exception const& _e)
 	{
-		AnsiColorized(cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(m_output, formatted, {BOLD, RED}) <<
 			"Exception during test: " << boost::diagnostic_information(_e) << endl;
 		return Result::Exception;
 	}
 	catch (...)
 	{
-		AnsiColorized(cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(m_output, formatted, {BOLD, RED}) <<
 			"Unknown exception during test: " << boost::current_exception_diagnostic_information() << endl;
 		return Result::Exception;
 	}
@@ -265,27 +322,42 @@ TestTool::Request TestTool::handleResponse(bool _exception)
 	}
 }
 
-TestStats TestTool::processPath(
-	TestCreator _testCaseCreator,
+string TestTool::resultName(Result _result)
+{
+	switch (_result)
+	{
+	case Result::Success: return "success";
+	case Result::Failure: return "failure";
+	case Result::Exception: return "exception";
+	case Result::Skipped: return "not run";
+	}
+	return {};
+}
+
+optional<TestTiming> TestTool::timing(Result _result, chrono::microseconds _duration) const
+{
+	if (!m_filter.matches(m_path, m_name))
+		return nullopt;
+	return TestTiming{m_name, resultName(_result), _duration};
+}
+
+vector<fs::path> TestTool::collectTests(
 	TestOptions const& _options,
 	fs::path const& _basepath,
 	fs::path const& _path
 )
 {
+	vector<fs::path> tests;
 	std::queue<fs::path> paths;
 	paths.push(_path);
-	int successCount = 0;
-	int testCount = 0;
-	int skippedCount = 0;
-
 	while (!paths.empty())
 	{
 		auto currentPath = paths.front();
+		paths.pop();
 
 		fs::path fullpath = _basepath / currentPath;
 		if (fs::is_directory(fullpath))
 		{
-			paths.pop();
 			for (auto const& entry: boost::iterator_range<fs::directory_iterator>(
 				fs::directory_iterator(fullpath),
 				fs::directory_iterator()
@@ -293,56 +365,283 @@ TestStats TestTool::processPath(
 				if (fs::is_directory(entry.path()) || TestCase::isTestFilename(entry.path().filename()))
 					paths.push(currentPath / entry.path().filename());
 		}
-		else if (m_exitRequested)
+		else
+			tests.push_back(currentPath);
+	}
+
+	// The order of directory entries is unspecified, so sort them to make the shards deterministic.
+	sort(tests.begin(), tests.end());
+	vector<fs::path> shard;
+	for (size_t i = 0; i < tests.size(); ++i)
+		if (i % _options.shardCount == _options.shardIndex)
+			shard.push_back(move(tests[i]));
+	return shard;
+}
+
+TestStats TestTool::processPath(
+	TestCreator _testCaseCreator,
+	TestOptions const& _options,
+	fs::path const& _basepath,
+	fs::path const& _path
+)
+{
+	vector<fs::path> tests = collectTests(_options, _basepath, _path);
+	TestStats stats = _options.jobs > 1 ?
+		processInParallel(_testCaseCreator, _options, _basepath, tests) :
+		processSequentially(_testCaseCreator, _options, _basepath, tests);
+	// Name the tests relative to the test directory.
+	for (TestTiming& timing: stats.timings)
+		timing.name = (_basepath.filename() / timing.name).generic_string();
+	return stats;
+}
+
+TestStats TestTool::processSequentially(
+	TestCreator _testCaseCreator,
+	TestOptions const& _options,
+	fs::path const& _basepath,
+	vector<fs::path> const& _tests
+)
+{
+	TestStats stats;
+
+	for (size_t index = 0; index < _tests.size();)
+	{
+		fs::path const& currentPath = _tests[index];
+		++stats.testCount;
+		if (m_exitRequested)
 		{
-			++testCount;
-			paths.pop();
+			++index;
+			continue;
 		}
-		else
+
+		TestTool testTool(
+			_testCaseCreator,
+			_options,
+			_basepath / currentPath,
+			currentPath.generic_path().string()
+		);
+		auto start = chrono::steady_clock::now();
+		auto result = testTool.process();
+		if (auto timing = testTool.timing(result, chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start)))
+			stats.timings.emplace_back(move(*timing));
+
+		switch(result)
 		{
-			++testCount;
-			TestTool testTool(
-				_testCaseCreator,
-				_options,
-				fullpath,
-				currentPath.generic_path().string()
-			);
-			auto result = testTool.process();
+		case Result::Failure:
+		case Result::Exception:
+			switch(testTool.handleResponse(result == Result::Exception))
+			{
+			case Request::Quit:
+				++index;
+				m_exitRequested = true;
+				break;
+			case Request::Rerun:
+				cout << "Re-running test case..." << endl;
+				--stats.testCount;
+				stats.timings.pop_back();
+				break;
+			case Request::Skip:
+				++index;
+				++stats.skippedCount;
+				break;
+			}
+			break;
+		case Result::Success:
+			++index;
+			++stats.successCount;
+			break;
+		case Result::Skipped:
+			++index;
+			++stats.skippedCount;
+			break;
+		}
+	}
+
+	return stats;
+}
 
-			switch(result)
+pair<TestTool::Result, optional<TestTiming>> TestTool::runTest(
+	TestCreator _testCaseCreator,
+	TestOptions const& _options,
+	fs::path const& _basepath,
+	fs::path const& _test,
+	ostream& _output
+)
+{
+	TestTool testTool(
+		_testCaseCreator,
+		_options,
+		_basepath / _test,
+		_test.generic_path().string(),
+		_output
+	);
+	while (true)
+	{
+		auto start = chrono::steady_clock::now();
+		auto result = testTool.process();
+		if (result == Result::Failure && _options.acceptUpdates)
+		{
+			testTool.updateTestCase();
+			_output << "Re-running test case..." << endl;
+			continue;
+		}
+		return {result, testTool.timing(result, chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start))};
+	}
+}
+
+#if !defined(_WIN32)
+namespace
+{
+
+void writeAll(int _fd, string const& _data)
+{
+	for (size_t written = 0; written < _data.size();)
+	{
+		ssize_t result = write(_fd, _data.data() + written, _data.size() - written);
+		if (result < 0 && errno != EINTR)
+			return;
+		if (result > 0)
+			written += static_cast<size_t>(result);
+	}
+}
+
+}
+#endif
+
+TestStats TestTool::processInParallel(
+	TestCreator _testCaseCreator,
+	TestOptions const& _options,
+	fs::path const& _basepath,
+	vector<fs::path> const& _tests
+)
+{
+#if defined(_WIN32)
+	// Rejected by IsolTestOptions::validate.
+	return processSequentially(_testCaseCreator, _options, _basepath, _tests);
+#else
+	// The compiler has process-wide state (e.g. the type provider and the Yul string repository)
+	// and the VMs keep state between calls, so the tests run in separate processes rather than
+	// threads. The workers take the index of the next test from a counter in shared memory.
+	void* sharedMemory = mmap(nullptr, sizeof(atomic<size_t>), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (sharedMemory == MAP_FAILED)
+		BOOST_THROW_EXCEPTION(runtime_error("Could not allocate memory shared with the worker processes."));
+	ScopeGuard unmapSharedMemory([&]() { munmap(sharedMemory, sizeof(atomic<size_t>)); });
+	auto* nextTest = new (sharedMemory) atomic<size_t>(0);
+
+	// Output buffered before the fork would otherwise be printed by every worker.
+	cout.flush();
+
+	struct Worker
+	{
+		pid_t pid;
+		int resultPipe;
+		string results;
+	};
+	vector<Worker> workers;
+	for (size_t i = 0; i < min(_options.jobs, _tests.size()); ++i)
+	{
+		int fds[2];
+		if (pipe(fds) != 0)
+			BOOST_THROW_EXCEPTION(runtime_error("Could not create a pipe to a worker process."));
+		pid_t pid = fork();
+		if (pid < 0)
+			BOOST_THROW_EXCEPTION(runtime_error("Could not start a worker process."));
+		if (pid == 0)
+		{
+			close(fds[0]);
+			int exitCode = 0;
+			try
 			{
-			case Result::Failure:
-			case Result::Exception:
-				switch(testTool.handleResponse(result == Result::Exception))
+				for (size_t index = nextTest->fetch_add(1); index < _tests.size(); index = nextTest->fetch_add(1))
 				{
-				case Request::Quit:
-					paths.pop();
-					m_exitRequested = true;
-					break;
-				case Request::Rerun:
-					cout << "Re-running test case..." << endl;
-					--testCount;
-					break;
-				case Request::Skip:
-					paths.pop();
-					++skippedCount;
-					break;
+					ostringstream output;
+					auto [result, timing] = runTest(_testCaseCreator, _options, _basepath, _tests[index], output);
+					// Write the output of a test at once, so that it does not interleave with other workers.
+					writeAll(STDOUT_FILENO, output.str());
+					writeAll(fds[1],
+						to_string(index) + " " +
+						to_string(static_cast<int>(result)) + " " +
+						(timing ? to_string(timing->duration.count()) : "-") + "\n"
+					);
 				}
-				break;
+			}
+			catch (...)
+			{
+				cerr << "Worker process failed: " << boost::current_exception_diagnostic_information() << endl;
+				exitCode = 1;
+			}
+			close(fds[1]);
+			_exit(exitCode);
+		}
+		close(fds[1]);
+		workers.push_back({pid, fds[0], {}});
+	}
+
+	// Read the results of all workers at the same time, so that none of them blocks on a full pipe.
+	vector<pollfd> pipes;
+	for (Worker const& worker: workers)
+		pipes.push_back({worker.resultPipe, POLLIN, 0});
+	for (size_t open = pipes.size(); open > 0;)
+	{
+		if (poll(pipes.data(), pipes.size(), -1) < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			BOOST_THROW_EXCEPTION(runtime_error("Could not read the results of the worker processes."));
+		}
+		for (size_t i = 0; i < pipes.size(); ++i)
+			if (pipes[i].fd >= 0 && pipes[i].revents)
+			{
+				char buffer[4096];
+				ssize_t count = read(pipes[i].fd, buffer, sizeof(buffer));
+				if (count > 0)
+					workers[i].results.append(buffer, static_cast<size_t>(count));
+				else if (count == 0 || errno != EINTR)
+				{
+					close(pipes[i].fd);
+					pipes[i].fd = -1;
+					--open;
+				}
+			}
+	}
+
+	TestStats stats;
+	stats.testCount = static_cast<int>(_tests.size());
+	for (Worker const& worker: workers)
+	{
+		int status = 0;
+		waitpid(worker.pid, &status, 0);
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+			cerr << "Worker process " << worker.pid << " terminated abnormally, its current test is counted as failed." << endl;
+
+		istringstream results(worker.results);
+		size_t index = 0;
+		int result = 0;
+		string duration;
+		while (results >> index >> result >> duration)
+		{
+			switch (static_cast<Result>(result))
+			{
 			case Result::Success:
-				paths.pop();
-				++successCount;
+				++stats.successCount;
 				break;
 			case Result::Skipped:
-				paths.pop();
-				++skippedCount;
+				++stats.skippedCount;
+				break;
+			case Result::Failure:
+			case Result::Exception:
 				break;
 			}
+			if (duration != "-")
+				stats.timings.push_back({
+					_tests[index].generic_path().string(),
+					resultName(static_cast<Result>(result)),
+					chrono::microseconds(stoll(duration))
+				});
 		}
 	}
-
-	return { successCount, testCount, skippedCount };
-
+	return stats;
+#endif
 }
 
 namespace
@@ -368,6 +667,30 @@ void setupTerminal()
 #endif
 }
 
+/// Writes the run times of @a _timings to @a _path as JSON, slowest first, and prints the slowest tests.
+void reportTimings(vector<TestTiming> _timings, string const& _path)
+{
+	stable_sort(_timings.begin(), _timings.end(), [](TestTiming const& _a, TestTiming const& _b) {
+		return _a.duration > _b.duration;
+	});
+
+	Json::Value report{Json::arrayValue};
+	for (TestTiming const& timing: _timings)
+	{
+		Json::Value entry{Json::objectValue};
+		entry["test"] = timing.name;
+		entry["result"] = timing.result;
+		entry["wallTime"] = Json::Int64(timing.duration.count());
+		report.append(move(entry));
+	}
+	ofstream(_path) << jsonPrettyPrint(report) << endl;
+
+	cout << endl << "Slowest tests:" << endl;
+	for (size_t i = 0; i < min<size_t>(10, _timings.size()); ++i)
+		cout << "  " << _timings[i].duration.count() / 1000 << " ms: " << _timings[i].name << endl;
+	cout << "Run times of " << _timings.size() << " tests written to " << _path << "." << endl;
+}
+
 std::optional<TestStats> runTestSuite(
 	TestCreator _testCaseCreator,
 	TestOptions const& _options,
@@ -437,7 +760,7 @@ int main(int argc, char const *argv[])
 		if (options.disableSemanticTests)
 			cout << endl << "--- SKIPPING ALL SEMANTICS TESTS ---" << endl << endl;
 
-		TestStats global_stats{0, 0};
+		TestStats global_stats;
 		cout << "Running tests..." << endl << endl;
 
 		// Actually run the tests.
@@ -475,6 +798,9 @@ int main(int argc, char const *argv[])
 		}
 		cout << "." << endl;
 
+		if (!options.timingReport.empty())
+			reportTimings(global_stats.timings, options.timingReport);
+
 		if (options.disableSemanticTests)
 			cout << "\nNOTE: Skipped semantics tests.\n" << endl;
 
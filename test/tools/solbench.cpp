@@ -0,0 +1,566 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Compiler performance benchmark. Compiles a fixed corpus of contracts from the test suite
+ * with the legacy and the IR-based pipeline and reports the time spent in the phases of the
+ * compilation together with the peak heap usage. The results can be compared against the
+ * results of a previous run to detect performance regressions.
+ */
+
+#include <test/TestCaseReader.h>
+
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/interface/OptimiserSettings.h>
+#include <libsolidity/interface/Version.h>
+
+#include <libyul/YulString.h>
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/Scanner.h>
+#include <liblangutil/SourceReferenceFormatter.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+#include <libsolutil/Profiler.h>
+
+#include <boost/algorithm/string/split.hpp>
+#include <boost/exception/diagnostic_information.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+using namespace solidity::util;
+
+namespace fs = boost::filesystem;
+namespace po = boost::program_options;
+
+namespace
+{
+
+/// Bytes currently allocated through the global operator new, their maximum since the last
+/// reset and the number of allocations on all threads.
+atomic<size_t> g_liveBytes{0};
+atomic<size_t> g_peakBytes{0};
+atomic<uint64_t> g_allocations{0};
+
+/// Every allocation is prefixed by its size so that operator delete can account for it.
+constexpr size_t c_allocationHeaderSize = alignof(max_align_t);
+
+void* trackedAllocate(size_t _size)
+{
+	countAllocation();
+	g_allocations.fetch_add(1, memory_order_relaxed);
+	void* allocation = nullptr;
+	while (!(allocation = malloc(_size + c_allocationHeaderSize)))
+		if (new_handler handler = get_new_handler())
+			handler();
+		else
+			throw bad_alloc();
+
+	*static_cast<size_t*>(allocation) = _size;
+	size_t live = g_liveBytes.fetch_add(_size, memory_order_relaxed) + _size;
+	size_t peak = g_peakBytes.load(memory_order_relaxed);
+	while (live > peak && !g_peakBytes.compare_exchange_weak(peak, live, memory_order_relaxed))
+		;
+	return static_cast<char*>(allocation) + c_allocationHeaderSize;
+}
+
+void trackedDeallocate(void* _pointer) noexcept
+{
+	if (!_pointer)
+		return;
+	void* allocation = static_cast<char*>(_pointer) - c_allocationHeaderSize;
+	g_liveBytes.fetch_sub(*static_cast<size_t*>(allocation), memory_order_relaxed);
+	free(allocation);
+}
+
+/// Contracts the benchmark compiles. The paths are relative to the test directory. Files are
+/// read as test cases, so that their external sources are included. Directories contribute all
+/// their Solidity files as separate source units.
+struct BenchmarkCase
+{
+	string name;
+	string path;
+};
+
+vector<BenchmarkCase> const c_corpus{
+	{"erc20", "libsolidity/semanticTests/various/erc20.sol"},
+	{"strings", "libsolidity/semanticTests/externalContracts/strings.sol"},
+	{"ramanujan_pi", "libsolidity/semanticTests/externalContracts/ramanujan_pi.sol"},
+	{"prbmath_signed", "libsolidity/semanticTests/externalContracts/prbmath_signed.sol"},
+	{"fixed_fee_registrar", "libsolidity/semanticTests/externalContracts/FixedFeeRegistrar.sol"},
+	{"deposit_contract", "libsolidity/semanticTests/externalContracts/deposit_contract.sol"},
+	{"snark", "libsolidity/semanticTests/externalContracts/snark.sol"},
+	{"multisig_wallet", "compilationTests/MultiSigWallet"},
+	{"milestonetracker", "compilationTests/milestonetracker"},
+	{"corion", "compilationTests/corion"},
+	{"gnosis", "compilationTests/gnosis"},
+};
+
+/// Compiler configurations every case is compiled with.
+vector<pair<string, bool>> const c_pipelines{
+	{"legacy", false},
+	{"via-ir", true},
+};
+
+/// Time measurements below this number of microseconds are too noisy to be compared.
+uint64_t const c_minimumComparedTime = 1000;
+
+/// Metrics of a single compilation. Times are in microseconds.
+struct Measurement
+{
+	map<string, uint64_t> wallTime;
+	uint64_t peakMemory = 0;
+	uint64_t allocations = 0;
+};
+
+map<string, string> loadSources(fs::path const& _path)
+{
+	map<string, string> sources;
+	if (fs::is_directory(_path))
+	{
+		for (auto const& entry: fs::recursive_directory_iterator(_path))
+			if (entry.path().extension() == ".sol")
+				sources[entry.path().lexically_relative(_path).generic_string()] = readFileAsString(entry.path());
+	}
+	else
+		for (auto const& [name, content]: frontend::test::TestCaseReader(_path.string()).sources().sources)
+			// Test cases with a single source do not name it.
+			sources[name.empty() ? _path.filename().string() : name] = content;
+	return sources;
+}
+
+/// @returns the sum of the wall times of the phases in @a _profile with the given category and,
+/// if @a _name is not empty, name.
+uint64_t phaseTime(Json::Value const& _profile, string const& _category, string const& _name = {})
+{
+	uint64_t total = 0;
+	for (auto const& phase: _profile["phases"])
+		if (phase["category"].asString() == _category && (_name.empty() || phase["name"].asString() == _name))
+			total += phase["wallTime"].asUInt64();
+	return total;
+}
+
+Measurement compile(map<string, string> const& _sources, bool _viaIR)
+{
+	// Like the command line interface, every compilation starts with an empty Yul string
+	// repository, so that repetitions do not see the strings of earlier ones.
+	yul::YulStringRepository::Session yulStringSession;
+	CompilerStack compiler;
+	compiler.setSources(_sources);
+	compiler.setViaIR(_viaIR);
+	compiler.setOptimiserSettings(OptimiserSettings::standard());
+	compiler.enableProfiling();
+
+	g_peakBytes = g_liveBytes.load();
+	size_t const initialBytes = g_liveBytes;
+	uint64_t const initialAllocations = g_allocations;
+	auto const start = chrono::steady_clock::now();
+
+	if (!compiler.compile())
+	{
+		string errors;
+		for (auto const& error: compiler.errors())
+			errors += SourceReferenceFormatter::formatErrorInformation(*error, compiler);
+		BOOST_THROW_EXCEPTION(runtime_error("Compilation failed:\n" + errors));
+	}
+
+	Measurement result;
+	result.wallTime["total"] = static_cast<uint64_t>(
+		chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count()
+	);
+	result.peakMemory = g_peakBytes - initialBytes;
+	result.allocations = g_allocations - initialAllocations;
+
+	Json::Value const profile = compiler.profile();
+	result.wallTime["parse"] = phaseTime(profile, "phase", "parsing");
+	result.wallTime["analyze"] = phaseTime(profile, "phase", "analysis");
+	result.wallTime["codegen"] = phaseTime(profile, "phase", "code generation");
+	result.wallTime["yulOptimizer"] = phaseTime(profile, "yulOptimiserStep");
+	result.wallTime["evmasmOptimizer"] = phaseTime(profile, "evmasm", "Assembly::optimise");
+	return result;
+}
+
+/// Compiles the sources @a _repetitions times and combines the results. Times are medians,
+/// memory and allocations are the maxima over all repetitions.
+Measurement measure(map<string, string> const& _sources, bool _viaIR, size_t _repetitions)
+{
+	vector<Measurement> runs;
+	for (size_t i = 0; i < _repetitions; ++i)
+		runs.emplace_back(compile(_sources, _viaIR));
+
+	Measurement result;
+	for (auto const& [metric, value]: runs.front().wallTime)
+	{
+		vector<uint64_t> times;
+		for (Measurement const& run: runs)
+			times.push_back(run.wallTime.at(metric));
+		nth_element(times.begin(), times.begin() + static_cast<ptrdiff_t>(times.size() / 2), times.end());
+		result.wallTime[metric] = times[times.size() / 2];
+	}
+	for (Measurement const& run: runs)
+	{
+		result.peakMemory = max(result.peakMemory, run.peakMemory);
+		result.allocations = max(result.allocations, run.allocations);
+	}
+	return result;
+}
+
+Json::Value toJson(Measurement const& _measurement)
+{
+	Json::Value result{Json::objectValue};
+	for (auto const& [metric, value]: _measurement.wallTime)
+		result["wallTime"][metric] = Json::UInt64(value);
+	result["peakMemory"] = Json::UInt64(_measurement.peakMemory);
+	result["allocations"] = Json::UInt64(_measurement.allocations);
+	return result;
+}
+
+/// Compares hashing inputs one by one with keccak256 to hashing them with keccak256Batch,
+/// for inputs of the size of function signatures, of Swarm tree nodes and of a few blocks.
+/// @returns the median times in microseconds over @a _repetitions runs.
+Json::Value benchmarkKeccak(size_t _repetitions)
+{
+	Json::Value results{Json::objectValue};
+	for (auto const& [name, size]: vector<pair<string, size_t>>{{"signature", 24}, {"node", 64}, {"blocks", 500}})
+	{
+		vector<bytes> inputs(10000, bytes(size));
+		for (size_t i = 0; i < inputs.size(); ++i)
+			for (size_t j = 0; j < size; ++j)
+				inputs[i][j] = static_cast<uint8_t>(i * 31 + j);
+		vector<bytesConstRef> references;
+		for (bytes const& input: inputs)
+			references.emplace_back(&input);
+
+		auto median = [&](auto const& _run) {
+			vector<uint64_t> times;
+			for (size_t i = 0; i < _repetitions; ++i)
+			{
+				auto const start = chrono::steady_clock::now();
+				_run();
+				times.push_back(static_cast<uint64_t>(
+					chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count()
+				));
+			}
+			nth_element(times.begin(), times.begin() + static_cast<ptrdiff_t>(times.size() / 2), times.end());
+			return times[times.size() / 2];
+		};
+		vector<h256> single;
+		vector<h256> batch;
+		results[name]["single"] = Json::UInt64(median([&]() {
+			single.clear();
+			for (bytesConstRef input: references)
+				single.push_back(keccak256(input));
+		}));
+		results[name]["batch"] = Json::UInt64(median([&]() { batch = keccak256Batch(references); }));
+		if (single != batch)
+			BOOST_THROW_EXCEPTION(runtime_error("keccak256 and keccak256Batch disagree."));
+	}
+	return results;
+}
+
+/// Tokenizes all Solidity files below @a _path, including the comments, and @returns the
+/// median time in microseconds over @a _repetitions runs together with the throughput.
+Json::Value benchmarkScanner(fs::path const& _path, size_t _repetitions)
+{
+	vector<CharStream> streams;
+	size_t bytes = 0;
+	for (auto const& entry: fs::recursive_directory_iterator(_path))
+		if (entry.path().extension() == ".sol")
+		{
+			streams.emplace_back(readFileAsString(entry.path()), entry.path().string());
+			bytes += streams.back().size();
+		}
+
+	size_t tokens = 0;
+	vector<uint64_t> times;
+	for (size_t i = 0; i < _repetitions; ++i)
+	{
+		tokens = 0;
+		auto const start = chrono::steady_clock::now();
+		for (CharStream& stream: streams)
+		{
+			Scanner scanner(stream);
+			while (scanner.currentToken() != Token::EOS)
+			{
+				scanner.next();
+				++tokens;
+			}
+		}
+		times.push_back(static_cast<uint64_t>(
+			chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count()
+		));
+	}
+	nth_element(times.begin(), times.begin() + static_cast<ptrdiff_t>(times.size() / 2), times.end());
+	uint64_t const time = max<uint64_t>(times[times.size() / 2], 1);
+
+	Json::Value results{Json::objectValue};
+	results["files"] = Json::UInt64(streams.size());
+	results["bytes"] = Json::UInt64(bytes);
+	results["tokens"] = Json::UInt64(tokens);
+	results["wallTime"] = Json::UInt64(time);
+	results["megabytesPerSecond"] = static_cast<double>(bytes) / static_cast<double>(time);
+	return results;
+}
+
+/// Prints the metrics that changed by more than @a _tolerance percent compared to @a _baseline
+/// and @returns the number of regressions.
+size_t compare(Json::Value const& _results, Json::Value const& _baseline, double _tolerance, ostream& _out)
+{
+	size_t regressions = 0;
+	auto check = [&](string const& _what, uint64_t _before, uint64_t _after) {
+		double change = 100.0 * (static_cast<double>(_after) - static_cast<double>(_before)) / static_cast<double>(_before);
+		if (abs(change) <= _tolerance)
+			return;
+		if (change > 0)
+			++regressions;
+		_out <<
+			(change > 0 ? "Regression: " : "Improvement: ") <<
+			_what << ": " << _before << " -> " << _after << " (" << (change > 0 ? "+" : "") <<
+			static_cast<int64_t>(change) << "%)" << endl;
+	};
+
+	for (string const& caseName: _results.getMemberNames())
+	{
+		if (!_baseline.isMember(caseName))
+			continue;
+		for (string const& pipeline: _results[caseName].getMemberNames())
+		{
+			Json::Value const& before = _baseline[caseName][pipeline];
+			Json::Value const& after = _results[caseName][pipeline];
+			if (!before.isObject())
+				continue;
+			string const prefix = caseName + " (" + pipeline + ") ";
+			for (string const& metric: after["wallTime"].getMemberNames())
+				if (before["wallTime"][metric].asUInt64() >= c_minimumComparedTime)
+					check(prefix + metric + " time [us]", before["wallTime"][metric].asUInt64(), after["wallTime"][metric].asUInt64());
+			if (before["peakMemory"].asUInt64() > 0)
+				check(prefix + "peak memory [bytes]", before["peakMemory"].asUInt64(), after["peakMemory"].asUInt64());
+		}
+	}
+	return regressions;
+}
+
+}
+
+void* operator new(size_t _size)
+{
+	return trackedAllocate(_size);
+}
+
+void* operator new[](size_t _size)
+{
+	return trackedAllocate(_size);
+}
+
+void operator delete(void* _pointer) noexcept
+{
+	trackedDeallocate(_pointer);
+}
+
+void operator delete[](void* _pointer) noexcept
+{
+	trackedDeallocate(_pointer);
+}
+
+void operator delete(void* _pointer, size_t) noexcept
+{
+	trackedDeallocate(_pointer);
+}
+
+void operator delete[](void* _pointer, size_t) noexcept
+{
+	trackedDeallocate(_pointer);
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		string testPath;
+		if (auto path = getenv("ETH_TEST_PATH"))
+			testPath = path;
+		else
+			testPath = "test";
+		size_t repetitions = 3;
+		double tolerance = 10;
+
+		po::options_description options(
+			R"(solbench, compiler performance benchmark.
+	Usage: solbench [Options]
+	Compiles a corpus of contracts from the test suite with the legacy and the
+	IR-based pipeline, both with the optimizer enabled, and outputs the median time
+	spent in each phase in microseconds and the peak heap usage in bytes as JSON.
+	If a baseline is given, the results are compared to it and the exit code is
+	non-zero if any metric got worse by more than the tolerance.
+	Times below 1 ms in the baseline are not compared.
+
+	Allowed options)",
+			po::options_description::m_default_line_length,
+			po::options_description::m_default_line_length - 23);
+		options.add_options()
+			(
+				"testpath",
+				po::value<string>(&testPath)->default_value(testPath),
+				"path to the test directory (default: $ETH_TEST_PATH or \"test\")"
+			)
+			(
+				"cases",
+				po::value<string>(),
+				"comma-separated names of the cases to run (default: all)"
+			)
+			(
+				"repetitions,r",
+				po::value<size_t>(&repetitions)->default_value(repetitions),
+				"number of times each case is compiled"
+			)
+			(
+				"output,o",
+				po::value<string>(),
+				"file to write the results to (default: standard output)"
+			)
+			(
+				"baseline",
+				po::value<string>(),
+				"results of a previous run to compare against"
+			)
+			(
+				"tolerance",
+				po::value<double>(&tolerance)->default_value(tolerance),
+				"relative change in percent up to which a metric is not reported"
+			)
+			("keccak", "Compare hashing with keccak256 and keccak256Batch and exit.")
+			("scanner", "Measure the throughput of the scanner on all Solidity files in the test directory and exit.")
+			("list", "List the names of the cases and exit.")
+			("help,h", "Show this help screen.");
+
+		po::variables_map arguments;
+		po::store(po::parse_command_line(argc, argv, options), arguments);
+		po::notify(arguments);
+
+		if (arguments.count("help"))
+		{
+			cout << options;
+			return 0;
+		}
+		if (arguments.count("list"))
+		{
+			for (BenchmarkCase const& benchmarkCase: c_corpus)
+				cout << benchmarkCase.name << " (" << benchmarkCase.path << ")" << endl;
+			return 0;
+		}
+		if (repetitions == 0)
+		{
+			cerr << "The number of repetitions must be positive." << endl;
+			return 1;
+		}
+		if (arguments.count("keccak"))
+		{
+			cout << jsonPrettyPrint(benchmarkKeccak(repetitions)) << endl;
+			return 0;
+		}
+		if (arguments.count("scanner"))
+		{
+			cout << jsonPrettyPrint(benchmarkScanner(testPath, repetitions)) << endl;
+			return 0;
+		}
+
+		vector<BenchmarkCase> cases;
+		if (arguments.count("cases"))
+		{
+			vector<string> names;
+			boost::split(names, arguments["cases"].as<string>(), [](char _c) { return _c == ','; });
+			for (string const& name: names)
+			{
+				auto it = find_if(c_corpus.begin(), c_corpus.end(), [&](BenchmarkCase const& _case) {
+					return _case.name == name;
+				});
+				if (it == c_corpus.end())
+				{
+					cerr << "Unknown case: " << name << endl;
+					return 1;
+				}
+				cases.push_back(*it);
+			}
+		}
+		else
+			cases = c_corpus;
+
+		Json::Value results{Json::objectValue};
+		for (BenchmarkCase const& benchmarkCase: cases)
+		{
+			map<string, string> sources = loadSources(fs::path(testPath) / benchmarkCase.path);
+			for (auto const& [pipeline, viaIR]: c_pipelines)
+			{
+				cerr << "Compiling " << benchmarkCase.name << " (" << pipeline << ")..." << endl;
+				results[benchmarkCase.name][pipeline] = toJson(measure(sources, viaIR, repetitions));
+			}
+		}
+
+		Json::Value output{Json::objectValue};
+		output["version"] = VersionString;
+		output["repetitions"] = Json::UInt64(repetitions);
+		output["results"] = results;
+		if (arguments.count("output"))
+			ofstream(arguments["output"].as<string>()) << jsonPrettyPrint(output) << endl;
+		else
+			cout << jsonPrettyPrint(output) << endl;
+
+		if (arguments.count("baseline"))
+		{
+			Json::Value baseline;
+			string errors;
+			if (!jsonParseStrict(readFileAsString(arguments["baseline"].as<string>()), baseline, &errors))
+			{
+				cerr << "Invalid baseline: " << errors << endl;
+				return 1;
+			}
+			size_t regressions = compare(results, baseline["results"], tolerance, cerr);
+			if (regressions > 0)
+			{
+				cerr << regressions << " metric(s) regressed by more than " << tolerance << "%." << endl;
+				return 2;
+			}
+		}
+		return 0;
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+	catch (std::exception const& _exception)
+	{
+		cerr << boost::diagnostic_information(_exception) << endl;
+		return 1;
+	}
+}
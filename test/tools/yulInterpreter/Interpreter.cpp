@@ -38,6 +38,7 @@
 
 #include <range/v3/view/reverse.hpp>
 
+#include <algorithm>
 #include <ostream>
 #include <variant>
 
@@ -48,11 +49,169 @@ using namespace solidity::yul::test;
 
 using solidity::util::h256;
 
+uint8_t& InterpreterMemory::access(u256 const& _offset)
+{
+	if (_offset >= c_contiguousLimit)
+		return m_sparse[_offset];
+
+	// Grow geometrically, so that sequential writes take amortized constant time.
+	size_t offset = static_cast<size_t>(_offset);
+	m_data.resize(min(c_contiguousLimit, max(offset + 1, 2 * m_data.size())), 0);
+	return m_data[offset];
+}
+
+namespace solidity::yul::test
+{
+
+/**
+ * Fills ResolvedNames by walking the AST according to the scoping rules of Yul.
+ */
+class NameResolver: public ASTWalker
+{
+public:
+	explicit NameResolver(ResolvedNames& _names): m_names(_names) {}
+
+	void run(Block const& _ast)
+	{
+		(*this)(_ast);
+		m_names.m_frameSizes[nullptr] = m_nextSlot;
+	}
+
+	using ASTWalker::operator();
+
+	void operator()(Identifier const& _identifier) override
+	{
+		for (auto scope = m_variableScopes.rbegin(); scope != m_variableScopes.rend(); ++scope)
+			if (auto it = scope->find(_identifier.name); it != scope->end())
+			{
+				m_names.m_references[&_identifier] = it->second;
+				return;
+			}
+		yulAssert(false, "Variable not found: " + _identifier.name.str());
+	}
+
+	void operator()(FunctionCall const& _call) override
+	{
+		// Calls that cannot be resolved are calls to builtins.
+		for (auto scope = m_functionScopes.rbegin(); scope != m_functionScopes.rend(); ++scope)
+			if (auto it = scope->find(_call.functionName.name); it != scope->end())
+			{
+				m_names.m_functions[&_call] = it->second;
+				break;
+			}
+		ASTWalker::operator()(_call);
+	}
+
+	void operator()(VariableDeclaration const& _declaration) override
+	{
+		ASTWalker::operator()(_declaration);
+		for (TypedName const& variable: _declaration.variables)
+			declare(variable);
+	}
+
+	void operator()(FunctionDefinition const& _function) override
+	{
+		// Functions cannot access the variables of the code they are defined in.
+		size_t outerNextSlot = exchange(m_nextSlot, 0);
+		auto outerVariableScopes = exchange(m_variableScopes, {{}});
+		for (TypedName const& parameter: _function.parameters)
+			declare(parameter);
+		for (TypedName const& returnVariable: _function.returnVariables)
+			declare(returnVariable);
+		(*this)(_function.body);
+		m_names.m_frameSizes[&_function] = m_nextSlot;
+		m_variableScopes = move(outerVariableScopes);
+		m_nextSlot = outerNextSlot;
+	}
+
+	void operator()(ForLoop const& _loop) override
+	{
+		// The scope of the initialisation block extends over the whole loop.
+		openScope(_loop.pre);
+		walkVector(_loop.pre.statements);
+		visit(*_loop.condition);
+		(*this)(_loop.body);
+		(*this)(_loop.post);
+		closeScope();
+	}
+
+	void operator()(Block const& _block) override
+	{
+		openScope(_block);
+		walkVector(_block.statements);
+		closeScope();
+	}
+
+private:
+	void openScope(Block const& _block)
+	{
+		m_variableScopes.emplace_back();
+		m_functionScopes.emplace_back();
+		for (auto const& statement: _block.statements)
+			if (auto const* function = get_if<FunctionDefinition>(&statement))
+				m_functionScopes.back()[function->name] = function;
+	}
+
+	void closeScope()
+	{
+		m_variableScopes.pop_back();
+		m_functionScopes.pop_back();
+	}
+
+	void declare(TypedName const& _variable)
+	{
+		size_t slot = m_nextSlot++;
+		m_variableScopes.back()[_variable.name] = slot;
+		m_names.m_declarations[&_variable] = slot;
+	}
+
+	ResolvedNames& m_names;
+	std::vector<std::map<YulString, size_t>> m_variableScopes;
+	std::vector<std::map<YulString, FunctionDefinition const*>> m_functionScopes;
+	size_t m_nextSlot = 0;
+};
+
+}
+
+ResolvedNames::ResolvedNames(Block const& _ast)
+{
+	NameResolver{*this}.run(_ast);
+}
+
+size_t ResolvedNames::slot(Identifier const& _identifier) const
+{
+	auto it = m_references.find(&_identifier);
+	yulAssert(it != m_references.end(), "");
+	return it->second;
+}
+
+size_t ResolvedNames::slot(TypedName const& _variable) const
+{
+	auto it = m_declarations.find(&_variable);
+	yulAssert(it != m_declarations.end(), "");
+	return it->second;
+}
+
+FunctionDefinition const* ResolvedNames::function(FunctionCall const& _call) const
+{
+	auto it = m_functions.find(&_call);
+	return it == m_functions.end() ? nullptr : it->second;
+}
+
+size_t ResolvedNames::frameSize(FunctionDefinition const* _function) const
+{
+	return m_frameSizes.at(_function);
+}
+
 void InterpreterState::dumpStorage(ostream& _out) const
 {
+	vector<pair<h256, h256>> slots;
 	for (auto const& slot: storage)
 		if (slot.second != h256{})
-			_out << "  " << slot.first.hex() << ": " << slot.second.hex() << endl;
+			slots.emplace_back(slot);
+	sort(slots.begin(), slots.end());
+	for (auto const& [key, value]: slots)
+		_out << "  " << key.hex() << ": " << value.hex() << endl;
 }
 
 void InterpreterState::dumpTraceAndState(ostream& _out) const
@@ -62,7 +221,11 @@ void InterpreterState::dumpTraceAndState(ostream& _out) const
 		_out << "  " << line << endl;
 	_out << "Memory dump:\n";
 	map<u256, u256> words;
-	for (auto const& [offset, value]: memory)
+	bytes const& contiguous = memory.contiguous();
+	for (size_t offset = 0; offset < contiguous.size(); ++offset)
+		if (contiguous[offset])
+			words[(offset / 0x20) * 0x20] |= u256(uint32_t(contiguous[offset])) << (256 - 8 - 8 * (offset % 0x20));
+	for (auto const& [offset, value]: memory.sparse())
 		words[(offset / 0x20) * 0x20] |= u256(uint32_t(value)) << (256 - 8 - 8 * static_cast<size_t>(offset % 0x20));
 	for (auto const& [offset, value]: words)
 		if (value != 0)
@@ -73,8 +236,8 @@ void InterpreterState::dumpTraceAndState(ostream& _out) const
 
 void Interpreter::run(InterpreterState& _state, Dialect const& _dialect, Block const& _ast)
 {
-	Scope scope;
-	Interpreter{_state, _dialect, scope}(_ast);
+	ResolvedNames names(_ast);
+	Interpreter{_state, _dialect, names, vector<u256>(names.frameSize(nullptr), 0)}(_ast);
 }
 
 void Interpreter::operator()(ExpressionStatement const& _expressionStatement)
@@ -88,11 +251,7 @@ void Interpreter::operator()(Assignment const& _assignment)
 	vector<u256> values = evaluateMulti(*_assignment.value);
 	solAssert(values.size() == _assignment.variableNames.size(), "");
 	for (size_t i = 0; i < values.size(); ++i)
-	{
-		YulString varName = _assignment.variableNames.at(i).name;
-		solAssert(m_variables.count(varName), "");
-		m_variables[varName] = values.at(i);
-	}
+		m_frame[m_names.slot(_assignment.variableNames.at(i))] = values.at(i);
 }
 
 void Interpreter::operator()(VariableDeclaration const& _declaration)
@@ -103,12 +262,7 @@ void Interpreter::operator()(VariableDeclaration const& _declaration)
 
 	solAssert(values.size() == _declaration.variables.size(), "");
 	for (size_t i = 0; i < values.size(); ++i)
-	{
-		YulString varName = _declaration.variables.at(i).name;
-		solAssert(!m_variables.count(varName), "");
-		m_variables[varName] = values.at(i);
-		m_scope->names.emplace(varName, nullptr);
-	}
+		m_frame[m_names.slot(_declaration.variables.at(i))] = values.at(i);
 }
 
 void Interpreter::operator()(If const& _if)
@@ -140,9 +294,6 @@ void Interpreter::operator()(ForLoop const& _forLoop)
 {
 	solAssert(_forLoop.condition, "");
 
-	enterScope(_forLoop.pre);
-	ScopeGuard g([this]{ leaveScope(); });
-
 	for (auto const& statement: _forLoop.pre.statements)
 	{
 		visit(statement);
@@ -187,15 +338,6 @@ void Interpreter::operator()(Leave const&)
 
 void Interpreter::operator()(Block const& _block)
 {
-	enterScope(_block);
-	// Register functions.
-	for (auto const& statement: _block.statements)
-		if (holds_alternative<FunctionDefinition>(statement))
-		{
-			FunctionDefinition const& funDef = std::get<FunctionDefinition>(statement);
-			m_scope->names.emplace(funDef.name, &funDef);
-		}
-
 	for (auto const& statement: _block.statements)
 	{
 		incrementStep();
@@ -203,44 +345,22 @@ void Interpreter::operator()(Block const& _block)
 		if (m_state.controlFlowState != ControlFlowState::Default)
 			break;
 	}
-
-	leaveScope();
 }
 
 u256 Interpreter::evaluate(Expression const& _expression)
 {
-	ExpressionEvaluator ev(m_state, m_dialect, *m_scope, m_variables);
+	ExpressionEvaluator ev(m_state, m_dialect, m_names, m_frame);
 	ev.visit(_expression);
 	return ev.value();
 }
 
 vector<u256> Interpreter::evaluateMulti(Expression const& _expression)
 {
-	ExpressionEvaluator ev(m_state, m_dialect, *m_scope, m_variables);
+	ExpressionEvaluator ev(m_state, m_dialect, m_names, m_frame);
 	ev.visit(_expression);
 	return ev.values();
 }
 
-void Interpreter::enterScope(Block const& _block)
-{
-	if (!m_scope->subScopes.count(&_block))
-		m_scope->subScopes[&_block] = make_unique<Scope>(Scope{
-			{},
-			{},
-			m_scope
-		});
-	m_scope = m_scope->subScopes[&_block].get();
-}
-
-void Interpreter::leaveScope()
-{
-	for (auto const& [var, funDeclaration]: m_scope->names)
-		if (!funDeclaration)
-			m_variables.erase(var);
-	m_scope = m_scope->parent;
-	yulAssert(m_scope, "");
-}
-
 void Interpreter::incrementStep()
 {
 	m_state.numSteps++;
@@ -254,17 +374,13 @@ void Interpreter::incrementStep()
 void ExpressionEvaluator::operator()(Literal const& _literal)
 {
 	incrementStep();
-	static YulString const trueString("true");
-	static YulString const falseString("false");
-
 	setValue(valueOfLiteral(_literal));
 }
 
 void ExpressionEvaluator::operator()(Identifier const& _identifier)
 {
-	solAssert(m_variables.count(_identifier.name), "");
 	incrementStep();
-	setValue(m_variables.at(_identifier.name));
+	setValue(m_frame[m_names.slot(_identifier)]);
 }
 
 void ExpressionEvaluator::operator()(FunctionCall const& _funCall)
@@ -292,29 +408,22 @@ void ExpressionEvaluator::operator()(FunctionCall const& _funCall)
 			return;
 		}
 
-	Scope* scope = &m_scope;
-	for (; scope; scope = scope->parent)
-		if (scope->names.count(_funCall.functionName.name))
-			break;
-	yulAssert(scope, "");
-
-	FunctionDefinition const* fun = scope->names.at(_funCall.functionName.name);
+	FunctionDefinition const* fun = m_names.function(_funCall);
 	yulAssert(fun, "Function not found.");
 	yulAssert(m_values.size() == fun->parameters.size(), "");
-	map<YulString, u256> variables;
+	// Return variables and all other variables start out as zero.
+	vector<u256> frame(m_names.frameSize(fun), 0);
 	for (size_t i = 0; i < fun->parameters.size(); ++i)
-		variables[fun->parameters.at(i).name] = m_values.at(i);
-	for (size_t i = 0; i < fun->returnVariables.size(); ++i)
-		variables[fun->returnVariables.at(i).name] = 0;
+		frame[m_names.slot(fun->parameters.at(i))] = m_values.at(i);
 
 	m_state.controlFlowState = ControlFlowState::Default;
-	Interpreter interpreter(m_state, m_dialect, *scope, std::move(variables));
+	Interpreter interpreter(m_state, m_dialect, m_names, std::move(frame));
 	interpreter(fun->body);
 	m_state.controlFlowState = ControlFlowState::Default;
 
 	m_values.clear();
 	for (auto const& retVar: fun->returnVariables)
-		m_values.emplace_back(interpreter.valueOfVariable(retVar.name));
+		m_values.emplace_back(interpreter.valueOfVariable(retVar));
 }
 
 u256 ExpressionEvaluator::value() const
@@ -29,7 +29,11 @@
 
 #include <libsolutil/Exceptions.h>
 
+#include <boost/functional/hash.hpp>
+
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -67,14 +71,54 @@ enum class ControlFlowState
 	Leave
 };
 
+/**
+ * Byte-addressed memory of the interpreter. Offsets used in practice are stored in a contiguous
+ * buffer that grows on demand. Since any offset can be accessed as long as the access is small,
+ * higher offsets are stored in a sparse map.
+ */
+class InterpreterMemory
+{
+public:
+	/// @returns the byte at @a _offset, which is zero if it has not been written to.
+	uint8_t& operator[](u256 const& _offset)
+	{
+		if (_offset < m_data.size())
+			return m_data[static_cast<size_t>(_offset)];
+		return access(_offset);
+	}
+
+	/// @returns the bytes at the offsets below the size of the contiguous buffer.
+	bytes const& contiguous() const { return m_data; }
+	/// @returns the bytes at higher offsets that have been accessed.
+	std::map<u256, uint8_t> const& sparse() const { return m_sparse; }
+
+private:
+	uint8_t& access(u256 const& _offset);
+
+	/// Offsets from which on the bytes are stored in the sparse map.
+	static size_t constexpr c_contiguousLimit = 0x100000;
+
+	bytes m_data;
+	std::map<u256, uint8_t> m_sparse;
+};
+
+/// Hash of storage slots, which are usually either small numbers or hashes.
+struct StorageSlotHash
+{
+	size_t operator()(util::h256 const& _slot) const
+	{
+		return boost::hash_range(_slot.data(), _slot.data() + util::h256::size);
+	}
+};
+
 struct InterpreterState
 {
 	bytes calldata;
 	bytes returndata;
-	std::map<u256, uint8_t> memory;
+	InterpreterMemory memory;
 	/// This is different than memory.size() because we ignore gas.
 	u256 msize;
-	std::map<util::h256, util::h256> storage;
+	std::unordered_map<util::h256, util::h256, StorageSlotHash> storage;
 	util::h160 address = util::h160("0x0000000000000000000000000000000011111111");
 	u256 balance = 0x22222222;
 	u256 selfbalance = 0x22223333;
@@ -108,14 +152,31 @@ struct InterpreterState
 };
 
 /**
- * Scope structure built and maintained during execution.
+ * Names of an AST resolved before it is run. Every variable is assigned a slot in the frame
+ * of the function that declares it and every call of a user-defined function is mapped to
+ * its definition, so that no names have to be looked up during execution.
  */
-struct Scope
+class ResolvedNames
 {
-	/// Used for variables and functions. Value is nullptr for variables.
-	std::map<YulString, FunctionDefinition const*> names;
-	std::map<Block const*, std::unique_ptr<Scope>> subScopes;
-	Scope* parent = nullptr;
+public:
+	explicit ResolvedNames(Block const& _ast);
+
+	/// @returns the slot of the variable referenced by @a _identifier.
+	size_t slot(Identifier const& _identifier) const;
+	/// @returns the slot of the variable declared by @a _variable.
+	size_t slot(TypedName const& _variable) const;
+	/// @returns the definition of the function called by @a _call, or nullptr for builtins.
+	FunctionDefinition const* function(FunctionCall const& _call) const;
+	/// @returns the number of slots of the frame of @a _function, or of the top-level code if it is nullptr.
+	size_t frameSize(FunctionDefinition const* _function) const;
+
+private:
+	friend class NameResolver;
+
+	std::unordered_map<Identifier const*, size_t> m_references;
+	std::unordered_map<TypedName const*, size_t> m_declarations;
+	std::unordered_map<FunctionCall const*, FunctionDefinition const*> m_functions;
+	std::unordered_map<FunctionDefinition const*, size_t> m_frameSizes;
 };
 
 /**
@@ -129,13 +190,13 @@ public:
 	Interpreter(
 		InterpreterState& _state,
 		Dialect const& _dialect,
-		Scope& _scope,
-		std::map<YulString, u256> _variables = {}
+		ResolvedNames const& _names,
+		std::vector<u256> _frame
 	):
 		m_dialect(_dialect),
 		m_state(_state),
-		m_variables(std::move(_variables)),
-		m_scope(&_scope)
+		m_names(_names),
+		m_frame(std::move(_frame))
 	{
 	}
 
@@ -153,7 +214,7 @@ public:
 
 	std::vector<std::string> const& trace() const { return m_state.trace; }
 
-	u256 valueOfVariable(YulString _name) const { return m_variables.at(_name); }
+	u256 valueOfVariable(TypedName const& _variable) const { return m_frame.at(m_names.slot(_variable)); }
 
 private:
 	/// Asserts that the expression evaluates to exactly one value and returns it.
@@ -161,18 +222,15 @@ private:
 	/// Evaluates the expression and returns its value.
 	std::vector<u256> evaluateMulti(Expression const& _expression);
 
-	void enterScope(Block const& _block);
-	void leaveScope();
-
 	/// Increment interpreter step count, throwing exception if step limit
 	/// is reached.
 	void incrementStep();
 
 	Dialect const& m_dialect;
 	InterpreterState& m_state;
-	/// Values of variables.
-	std::map<YulString, u256> m_variables;
-	Scope* m_scope;
+	ResolvedNames const& m_names;
+	/// Values of the variables of the current function, indexed by their slots.
+	std::vector<u256> m_frame;
 };
 
 /**
@@ -184,13 +242,13 @@ public:
 	ExpressionEvaluator(
 		InterpreterState& _state,
 		Dialect const& _dialect,
-		Scope& _scope,
-		std::map<YulString, u256> const& _variables
+		ResolvedNames const& _names,
+		std::vector<u256> const& _frame
 	):
 		m_state(_state),
 		m_dialect(_dialect),
-		m_variables(_variables),
-		m_scope(_scope)
+		m_names(_names),
+		m_frame(_frame)
 	{}
 
 	void operator()(Literal const&) override;
@@ -219,9 +277,9 @@ private:
 
 	InterpreterState& m_state;
 	Dialect const& m_dialect;
-	/// Values of variables.
-	std::map<YulString, u256> const& m_variables;
-	Scope& m_scope;
+	ResolvedNames const& m_names;
+	/// Values of the variables of the current function, indexed by their slots.
+	std::vector<u256> const& m_frame;
 	/// Current value of the expression
 	std::vector<u256> m_values;
 	/// Current expression nesting level